@@ -1,63 +1,63 @@
-/* Microchip Technology Inc. and its subsidiaries.  You may use this software 
- * and any derivatives exclusively with Microchip products. 
- * 
- * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
- * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
- * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
- * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
- * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
- *
- * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
- * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
- * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
- * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
- * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
- * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
- * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
- *
- * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
- * TERMS. 
- */
-
-/* 
- * File: adc
- * Author: Tyler Matthews
- * Comments: adc are used to measure current and temperatures
- * Revision history: 
- */
-
-//Includes
-    #include <xc.h> // include processor files - each processor file is guarded.  
-    #include "timer.h"
-    #include <math.h>
-
-//Defines
-    #define GPIO1 00000
-    #define GPIO2 00001
-    #define GPIO3 00010
-    #define GPIO4 00011
-    #define TEMPFET LATBbits.LATB5
-    #define TEMP1 01100 
-    #define TEMP2 01010
-    #define TEMP3 01000
-    #define TEMP4 01001
-    #define TEMP5 01011
-    #define CSENSE 10101
-
-//Prototypes
-    void adcSetup();
-    int adcRead(char ch);
-    
-    float avgBuff(float buff[], int size);
-    
-    int getTemps(int temperatures[], int numTemps);
-    float getCurrent();
-    
-    int calculateTemp(int temp);
-    float calculateCurrent(float adcValue);
-
-//Variables
-    char tempChannels[5] = {0xC, 0x0A, 0x08, 0x09, 0x0B}; //TEMP1, TEMP2, ...., TEMP5
-    
-    const int Beta = 3977;
+/* Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ */
+
+/* 
+ * File: adc
+ * Author: Tyler Matthews
+ * Comments: adc are used to measure current and temperatures
+ * Revision history: 
+ */
+
+//Includes
+    #include <xc.h> // include processor files - each processor file is guarded.  
+    #include "timer.h"
+    #include <math.h>
+
+//Defines
+    #define GPIO1 00000
+    #define GPIO2 00001
+    #define GPIO3 00010
+    #define GPIO4 00011
+    #define TEMPFET LATBbits.LATB5
+    #define TEMP1 01100 
+    #define TEMP2 01010
+    #define TEMP3 01000
+    #define TEMP4 01001
+    #define TEMP5 01011
+    #define CSENSE 10101
+
+//Prototypes
+    void adcSetup();
+    int adcRead(char ch);
+    
+    float avgBuff(float buff[], int size);
+    
+    int getTemps(int temperatures[], int numTemps);
+    float getCurrent();
+    
+    int calculateTemp(int temp);
+    float calculateCurrent(float adcValue);
+
+//Variables
+    char tempChannels[5] = {0xC, 0x0A, 0x08, 0x09, 0x0B}; //TEMP1, TEMP2, ...., TEMP5
+    
+    const int Beta = 3977;
     const float t0 = 298.15;
\ No newline at end of file
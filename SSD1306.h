@@ -1,164 +1,164 @@
-#include <xc.h>
-#include "i2c.h"
-
-#define SSD1306_WRITE 0x78 //Address for writing
-
-#define SSD1306_CMD 0x80 //Sending one command byte
-#define SSD1306_DATA 0xC0 //Sending one data byte
-
-#define SSD1306_CONT_DATA 0x40 //Continually send data until i2cStop
-
-#define SSD1306_CONTRAST 0x81 //Change Contrast / Brightness
-
-#define SSD1306_NORMAL_MODE 0xA6 //Normal
-#define SSD1306_INVERTED_MODE 0xA7 //Inverted (ie: 0=1 & 1=0)
-
-#define SSD1306_ENTIRE_DISPLAY_ON_RESET 0xA4 //Display follows RAM
-#define SSD1306_ENTIRE_DISPLAY_ON 0XA5 //Entire Display is on
-
-#define SSD1306_DISPLAY_OFF 0xAE //turns the display off
-#define SSD1306_DISPLAY_ON 0xAF //turns the display on
-
-#define SSD1306_SET_MEMORY_ADDRESSING_MODE 0x20 //Memory Addressing Mode Cmd
-#define SSD1306_HORIZONTAL_ADDRESSING_MODE 0x00 //Horizontal
-#define SSD1306_VERTICAL_ADDRESSING_MODE 0x01 //Vertical
-#define SSD1306_PAGE_ADDRESSING_MODE  0x02 //Page
-
-#define SSD1306_DEACTIVATE_SCROLL 0x2E
-
-#define SSD1306_SET_COLUMN_ADDRESS 0x21 //Column Start Address Cmd
-#define SSD1306_SET_PAGE_ADDRESS_RANGE 0x22 //Page Range cmd for Horizontal/Vertical Mode
-
-void SSD1306_Command(int numCmd, char cmd[]);
-void SSD1306_Data(char data);
-
-void SSD1306_Init();
-void SSD1306_ClearScreen();
-void SSD1306_FillScreen();
-
-void SSD1306_SetDisplayStartLine(char start);
-void SSD1306_SetBrightness(char val);
-void SSD1306_ChargePump();
-void SSD1306_NormalMode();
-void SSD1306_DeactivateScroll();
-void SSD1306_EntireDisplayOn();
-void SSD1306_EntireDisplayOnReset();
-
-void SSD1306_SetPageAddressRange(char start, char end);
-void SSD1306_ColumnStartAndEndAddress(char start, char end);
-void SSD1306_HorizontalAddressingMode();
-
-void SSD1306_PageAddressingMode();
-void SSD1306_PageAddressingModeColumns(char start, char end);
-void SSD1306_PageAddressingModePage(char page);
-
-void SSD1306_OFF();
-void SSD1306_ON();
-
-void SSD1306_Test();
-
-
-
-void oledPutChar( char ch );
-void oledClear();
-void oledGotoYX(unsigned char Row, unsigned char Column);
-
-const char OledFont[][8] =
-{
-  {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
-  {0x00,0x00,0x5F,0x00,0x00,0x00,0x00,0x00},
-  {0x00,0x00,0x07,0x00,0x07,0x00,0x00,0x00},
-  {0x00,0x14,0x7F,0x14,0x7F,0x14,0x00,0x00},
-  {0x00,0x24,0x2A,0x7F,0x2A,0x12,0x00,0x00},
-  {0x00,0x23,0x13,0x08,0x64,0x62,0x00,0x00},
-  {0x00,0x36,0x49,0x55,0x22,0x50,0x00,0x00},
-  {0x00,0x00,0x05,0x03,0x00,0x00,0x00,0x00},
-  {0x00,0x1C,0x22,0x41,0x00,0x00,0x00,0x00},
-  {0x00,0x41,0x22,0x1C,0x00,0x00,0x00,0x00},
-  {0x00,0x08,0x2A,0x1C,0x2A,0x08,0x00,0x00},
-  {0x00,0x08,0x08,0x3E,0x08,0x08,0x00,0x00},
-  {0x00,0xA0,0x60,0x00,0x00,0x00,0x00,0x00},
-  {0x00,0x08,0x08,0x08,0x08,0x08,0x00,0x00},
-  {0x00,0x60,0x60,0x00,0x00,0x00,0x00,0x00},
-  {0x00,0x20,0x10,0x08,0x04,0x02,0x00,0x00},
-  {0x00,0x3E,0x51,0x49,0x45,0x3E,0x00,0x00},
-  {0x00,0x00,0x42,0x7F,0x40,0x00,0x00,0x00},
-  {0x00,0x62,0x51,0x49,0x49,0x46,0x00,0x00},
-  {0x00,0x22,0x41,0x49,0x49,0x36,0x00,0x00},
-  {0x00,0x18,0x14,0x12,0x7F,0x10,0x00,0x00},
-  {0x00,0x27,0x45,0x45,0x45,0x39,0x00,0x00},
-  {0x00,0x3C,0x4A,0x49,0x49,0x30,0x00,0x00},
-  {0x00,0x01,0x71,0x09,0x05,0x03,0x00,0x00},
-  {0x00,0x36,0x49,0x49,0x49,0x36,0x00,0x00},
-  {0x00,0x06,0x49,0x49,0x29,0x1E,0x00,0x00},
-  {0x00,0x00,0x36,0x36,0x00,0x00,0x00,0x00},
-  {0x00,0x00,0xAC,0x6C,0x00,0x00,0x00,0x00},
-  {0x00,0x08,0x14,0x22,0x41,0x00,0x00,0x00},
-  {0x00,0x14,0x14,0x14,0x14,0x14,0x00,0x00},
-  {0x00,0x41,0x22,0x14,0x08,0x00,0x00,0x00},
-  {0x00,0x02,0x01,0x51,0x09,0x06,0x00,0x00},
-  {0x00,0x32,0x49,0x79,0x41,0x3E,0x00,0x00},
-  {0x00,0x7E,0x09,0x09,0x09,0x7E,0x00,0x00},
-  {0x00,0x7F,0x49,0x49,0x49,0x36,0x00,0x00},
-  {0x00,0x3E,0x41,0x41,0x41,0x22,0x00,0x00},
-  {0x00,0x7F,0x41,0x41,0x22,0x1C,0x00,0x00},
-  {0x00,0x7F,0x49,0x49,0x49,0x41,0x00,0x00},
-  {0x00,0x7F,0x09,0x09,0x09,0x01,0x00,0x00},
-  {0x00,0x3E,0x41,0x41,0x51,0x72,0x00,0x00},
-  {0x00,0x7F,0x08,0x08,0x08,0x7F,0x00,0x00},
-  {0x00,0x41,0x7F,0x41,0x00,0x00,0x00,0x00},
-  {0x00,0x20,0x40,0x41,0x3F,0x01,0x00,0x00},
-  {0x00,0x7F,0x08,0x14,0x22,0x41,0x00,0x00},
-  {0x00,0x7F,0x40,0x40,0x40,0x40,0x00,0x00},
-  {0x00,0x7F,0x02,0x0C,0x02,0x7F,0x00,0x00},
-  {0x00,0x7F,0x04,0x08,0x10,0x7F,0x00,0x00},
-  {0x00,0x3E,0x41,0x41,0x41,0x3E,0x00,0x00},
-  {0x00,0x7F,0x09,0x09,0x09,0x06,0x00,0x00},
-  {0x00,0x3E,0x41,0x51,0x21,0x5E,0x00,0x00},
-  {0x00,0x7F,0x09,0x19,0x29,0x46,0x00,0x00},
-  {0x00,0x26,0x49,0x49,0x49,0x32,0x00,0x00},
-  {0x00,0x01,0x01,0x7F,0x01,0x01,0x00,0x00},
-  {0x00,0x3F,0x40,0x40,0x40,0x3F,0x00,0x00},
-  {0x00,0x1F,0x20,0x40,0x20,0x1F,0x00,0x00},
-  {0x00,0x3F,0x40,0x38,0x40,0x3F,0x00,0x00},
-  {0x00,0x63,0x14,0x08,0x14,0x63,0x00,0x00},
-  {0x00,0x03,0x04,0x78,0x04,0x03,0x00,0x00},
-  {0x00,0x61,0x51,0x49,0x45,0x43,0x00,0x00},
-  {0x00,0x7F,0x41,0x41,0x00,0x00,0x00,0x00},
-  {0x00,0x02,0x04,0x08,0x10,0x20,0x00,0x00},
-  {0x00,0x41,0x41,0x7F,0x00,0x00,0x00,0x00},
-  {0x00,0x04,0x02,0x01,0x02,0x04,0x00,0x00},
-  {0x00,0x80,0x80,0x80,0x80,0x80,0x00,0x00},
-  {0x00,0x01,0x02,0x04,0x00,0x00,0x00,0x00},
-  {0x00,0x20,0x54,0x54,0x54,0x78,0x00,0x00},
-  {0x00,0x7F,0x48,0x44,0x44,0x38,0x00,0x00},
-  {0x00,0x38,0x44,0x44,0x28,0x00,0x00,0x00},
-  {0x00,0x38,0x44,0x44,0x48,0x7F,0x00,0x00},
-  {0x00,0x38,0x54,0x54,0x54,0x18,0x00,0x00},
-  {0x00,0x08,0x7E,0x09,0x02,0x00,0x00,0x00},
-  {0x00,0x18,0xA4,0xA4,0xA4,0x7C,0x00,0x00},
-  {0x00,0x7F,0x08,0x04,0x04,0x78,0x00,0x00},
-  {0x00,0x00,0x7D,0x00,0x00,0x00,0x00,0x00},
-  {0x00,0x80,0x84,0x7D,0x00,0x00,0x00,0x00},
-  {0x00,0x7F,0x10,0x28,0x44,0x00,0x00,0x00},
-  {0x00,0x41,0x7F,0x40,0x00,0x00,0x00,0x00},
-  {0x00,0x7C,0x04,0x18,0x04,0x78,0x00,0x00},
-  {0x00,0x7C,0x08,0x04,0x7C,0x00,0x00,0x00},
-  {0x00,0x38,0x44,0x44,0x38,0x00,0x00,0x00},
-  {0x00,0xFC,0x24,0x24,0x18,0x00,0x00,0x00},
-  {0x00,0x18,0x24,0x24,0xFC,0x00,0x00,0x00},
-  {0x00,0x00,0x7C,0x08,0x04,0x00,0x00,0x00},
-  {0x00,0x48,0x54,0x54,0x24,0x00,0x00,0x00},
-  {0x00,0x04,0x7F,0x44,0x00,0x00,0x00,0x00},
-  {0x00,0x3C,0x40,0x40,0x7C,0x00,0x00,0x00},
-  {0x00,0x1C,0x20,0x40,0x20,0x1C,0x00,0x00},
-  {0x00,0x3C,0x40,0x30,0x40,0x3C,0x00,0x00},
-  {0x00,0x44,0x28,0x10,0x28,0x44,0x00,0x00},
-  {0x00,0x1C,0xA0,0xA0,0x7C,0x00,0x00,0x00},
-  {0x00,0x44,0x64,0x54,0x4C,0x44,0x00,0x00},
-  {0x00,0x08,0x36,0x41,0x00,0x00,0x00,0x00},
-  {0x00,0x00,0x7F,0x00,0x00,0x00,0x00,0x00},
-  {0x00,0x41,0x36,0x08,0x00,0x00,0x00,0x00},
-  {0x00,0x02,0x01,0x01,0x02,0x01,0x00,0x00},
-  {0x00,0x02,0x05,0x05,0x02,0x00,0x00,0x00}
-};
+#include <xc.h>
+#include "i2c.h"
+
+#define SSD1306_WRITE 0x78 //Address for writing
+
+#define SSD1306_CMD 0x80 //Sending one command byte
+#define SSD1306_DATA 0xC0 //Sending one data byte
+
+#define SSD1306_CONT_DATA 0x40 //Continually send data until i2cStop
+
+#define SSD1306_CONTRAST 0x81 //Change Contrast / Brightness
+
+#define SSD1306_NORMAL_MODE 0xA6 //Normal
+#define SSD1306_INVERTED_MODE 0xA7 //Inverted (ie: 0=1 & 1=0)
+
+#define SSD1306_ENTIRE_DISPLAY_ON_RESET 0xA4 //Display follows RAM
+#define SSD1306_ENTIRE_DISPLAY_ON 0XA5 //Entire Display is on
+
+#define SSD1306_DISPLAY_OFF 0xAE //turns the display off
+#define SSD1306_DISPLAY_ON 0xAF //turns the display on
+
+#define SSD1306_SET_MEMORY_ADDRESSING_MODE 0x20 //Memory Addressing Mode Cmd
+#define SSD1306_HORIZONTAL_ADDRESSING_MODE 0x00 //Horizontal
+#define SSD1306_VERTICAL_ADDRESSING_MODE 0x01 //Vertical
+#define SSD1306_PAGE_ADDRESSING_MODE  0x02 //Page
+
+#define SSD1306_DEACTIVATE_SCROLL 0x2E
+
+#define SSD1306_SET_COLUMN_ADDRESS 0x21 //Column Start Address Cmd
+#define SSD1306_SET_PAGE_ADDRESS_RANGE 0x22 //Page Range cmd for Horizontal/Vertical Mode
+
+void SSD1306_Command(int numCmd, char cmd[]);
+void SSD1306_Data(char data);
+
+void SSD1306_Init();
+void SSD1306_ClearScreen();
+void SSD1306_FillScreen();
+
+void SSD1306_SetDisplayStartLine(char start);
+void SSD1306_SetBrightness(char val);
+void SSD1306_ChargePump();
+void SSD1306_NormalMode();
+void SSD1306_DeactivateScroll();
+void SSD1306_EntireDisplayOn();
+void SSD1306_EntireDisplayOnReset();
+
+void SSD1306_SetPageAddressRange(char start, char end);
+void SSD1306_ColumnStartAndEndAddress(char start, char end);
+void SSD1306_HorizontalAddressingMode();
+
+void SSD1306_PageAddressingMode();
+void SSD1306_PageAddressingModeColumns(char start, char end);
+void SSD1306_PageAddressingModePage(char page);
+
+void SSD1306_OFF();
+void SSD1306_ON();
+
+void SSD1306_Test();
+
+
+
+void oledPutChar( char ch );
+void oledClear();
+void oledGotoYX(unsigned char Row, unsigned char Column);
+
+const char OledFont[][8] =
+{
+  {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+  {0x00,0x00,0x5F,0x00,0x00,0x00,0x00,0x00},
+  {0x00,0x00,0x07,0x00,0x07,0x00,0x00,0x00},
+  {0x00,0x14,0x7F,0x14,0x7F,0x14,0x00,0x00},
+  {0x00,0x24,0x2A,0x7F,0x2A,0x12,0x00,0x00},
+  {0x00,0x23,0x13,0x08,0x64,0x62,0x00,0x00},
+  {0x00,0x36,0x49,0x55,0x22,0x50,0x00,0x00},
+  {0x00,0x00,0x05,0x03,0x00,0x00,0x00,0x00},
+  {0x00,0x1C,0x22,0x41,0x00,0x00,0x00,0x00},
+  {0x00,0x41,0x22,0x1C,0x00,0x00,0x00,0x00},
+  {0x00,0x08,0x2A,0x1C,0x2A,0x08,0x00,0x00},
+  {0x00,0x08,0x08,0x3E,0x08,0x08,0x00,0x00},
+  {0x00,0xA0,0x60,0x00,0x00,0x00,0x00,0x00},
+  {0x00,0x08,0x08,0x08,0x08,0x08,0x00,0x00},
+  {0x00,0x60,0x60,0x00,0x00,0x00,0x00,0x00},
+  {0x00,0x20,0x10,0x08,0x04,0x02,0x00,0x00},
+  {0x00,0x3E,0x51,0x49,0x45,0x3E,0x00,0x00},
+  {0x00,0x00,0x42,0x7F,0x40,0x00,0x00,0x00},
+  {0x00,0x62,0x51,0x49,0x49,0x46,0x00,0x00},
+  {0x00,0x22,0x41,0x49,0x49,0x36,0x00,0x00},
+  {0x00,0x18,0x14,0x12,0x7F,0x10,0x00,0x00},
+  {0x00,0x27,0x45,0x45,0x45,0x39,0x00,0x00},
+  {0x00,0x3C,0x4A,0x49,0x49,0x30,0x00,0x00},
+  {0x00,0x01,0x71,0x09,0x05,0x03,0x00,0x00},
+  {0x00,0x36,0x49,0x49,0x49,0x36,0x00,0x00},
+  {0x00,0x06,0x49,0x49,0x29,0x1E,0x00,0x00},
+  {0x00,0x00,0x36,0x36,0x00,0x00,0x00,0x00},
+  {0x00,0x00,0xAC,0x6C,0x00,0x00,0x00,0x00},
+  {0x00,0x08,0x14,0x22,0x41,0x00,0x00,0x00},
+  {0x00,0x14,0x14,0x14,0x14,0x14,0x00,0x00},
+  {0x00,0x41,0x22,0x14,0x08,0x00,0x00,0x00},
+  {0x00,0x02,0x01,0x51,0x09,0x06,0x00,0x00},
+  {0x00,0x32,0x49,0x79,0x41,0x3E,0x00,0x00},
+  {0x00,0x7E,0x09,0x09,0x09,0x7E,0x00,0x00},
+  {0x00,0x7F,0x49,0x49,0x49,0x36,0x00,0x00},
+  {0x00,0x3E,0x41,0x41,0x41,0x22,0x00,0x00},
+  {0x00,0x7F,0x41,0x41,0x22,0x1C,0x00,0x00},
+  {0x00,0x7F,0x49,0x49,0x49,0x41,0x00,0x00},
+  {0x00,0x7F,0x09,0x09,0x09,0x01,0x00,0x00},
+  {0x00,0x3E,0x41,0x41,0x51,0x72,0x00,0x00},
+  {0x00,0x7F,0x08,0x08,0x08,0x7F,0x00,0x00},
+  {0x00,0x41,0x7F,0x41,0x00,0x00,0x00,0x00},
+  {0x00,0x20,0x40,0x41,0x3F,0x01,0x00,0x00},
+  {0x00,0x7F,0x08,0x14,0x22,0x41,0x00,0x00},
+  {0x00,0x7F,0x40,0x40,0x40,0x40,0x00,0x00},
+  {0x00,0x7F,0x02,0x0C,0x02,0x7F,0x00,0x00},
+  {0x00,0x7F,0x04,0x08,0x10,0x7F,0x00,0x00},
+  {0x00,0x3E,0x41,0x41,0x41,0x3E,0x00,0x00},
+  {0x00,0x7F,0x09,0x09,0x09,0x06,0x00,0x00},
+  {0x00,0x3E,0x41,0x51,0x21,0x5E,0x00,0x00},
+  {0x00,0x7F,0x09,0x19,0x29,0x46,0x00,0x00},
+  {0x00,0x26,0x49,0x49,0x49,0x32,0x00,0x00},
+  {0x00,0x01,0x01,0x7F,0x01,0x01,0x00,0x00},
+  {0x00,0x3F,0x40,0x40,0x40,0x3F,0x00,0x00},
+  {0x00,0x1F,0x20,0x40,0x20,0x1F,0x00,0x00},
+  {0x00,0x3F,0x40,0x38,0x40,0x3F,0x00,0x00},
+  {0x00,0x63,0x14,0x08,0x14,0x63,0x00,0x00},
+  {0x00,0x03,0x04,0x78,0x04,0x03,0x00,0x00},
+  {0x00,0x61,0x51,0x49,0x45,0x43,0x00,0x00},
+  {0x00,0x7F,0x41,0x41,0x00,0x00,0x00,0x00},
+  {0x00,0x02,0x04,0x08,0x10,0x20,0x00,0x00},
+  {0x00,0x41,0x41,0x7F,0x00,0x00,0x00,0x00},
+  {0x00,0x04,0x02,0x01,0x02,0x04,0x00,0x00},
+  {0x00,0x80,0x80,0x80,0x80,0x80,0x00,0x00},
+  {0x00,0x01,0x02,0x04,0x00,0x00,0x00,0x00},
+  {0x00,0x20,0x54,0x54,0x54,0x78,0x00,0x00},
+  {0x00,0x7F,0x48,0x44,0x44,0x38,0x00,0x00},
+  {0x00,0x38,0x44,0x44,0x28,0x00,0x00,0x00},
+  {0x00,0x38,0x44,0x44,0x48,0x7F,0x00,0x00},
+  {0x00,0x38,0x54,0x54,0x54,0x18,0x00,0x00},
+  {0x00,0x08,0x7E,0x09,0x02,0x00,0x00,0x00},
+  {0x00,0x18,0xA4,0xA4,0xA4,0x7C,0x00,0x00},
+  {0x00,0x7F,0x08,0x04,0x04,0x78,0x00,0x00},
+  {0x00,0x00,0x7D,0x00,0x00,0x00,0x00,0x00},
+  {0x00,0x80,0x84,0x7D,0x00,0x00,0x00,0x00},
+  {0x00,0x7F,0x10,0x28,0x44,0x00,0x00,0x00},
+  {0x00,0x41,0x7F,0x40,0x00,0x00,0x00,0x00},
+  {0x00,0x7C,0x04,0x18,0x04,0x78,0x00,0x00},
+  {0x00,0x7C,0x08,0x04,0x7C,0x00,0x00,0x00},
+  {0x00,0x38,0x44,0x44,0x38,0x00,0x00,0x00},
+  {0x00,0xFC,0x24,0x24,0x18,0x00,0x00,0x00},
+  {0x00,0x18,0x24,0x24,0xFC,0x00,0x00,0x00},
+  {0x00,0x00,0x7C,0x08,0x04,0x00,0x00,0x00},
+  {0x00,0x48,0x54,0x54,0x24,0x00,0x00,0x00},
+  {0x00,0x04,0x7F,0x44,0x00,0x00,0x00,0x00},
+  {0x00,0x3C,0x40,0x40,0x7C,0x00,0x00,0x00},
+  {0x00,0x1C,0x20,0x40,0x20,0x1C,0x00,0x00},
+  {0x00,0x3C,0x40,0x30,0x40,0x3C,0x00,0x00},
+  {0x00,0x44,0x28,0x10,0x28,0x44,0x00,0x00},
+  {0x00,0x1C,0xA0,0xA0,0x7C,0x00,0x00,0x00},
+  {0x00,0x44,0x64,0x54,0x4C,0x44,0x00,0x00},
+  {0x00,0x08,0x36,0x41,0x00,0x00,0x00,0x00},
+  {0x00,0x00,0x7F,0x00,0x00,0x00,0x00,0x00},
+  {0x00,0x41,0x36,0x08,0x00,0x00,0x00,0x00},
+  {0x00,0x02,0x01,0x01,0x02,0x01,0x00,0x00},
+  {0x00,0x02,0x05,0x05,0x02,0x00,0x00,0x00}
+};
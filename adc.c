@@ -1,107 +1,193 @@
-/*
- * File:   adc.c
- * Author: trm84
- *
- * Created on February 5, 2019, 1:02 PM
- */
-#include "adc.h"
-
-//Returns the current
-
-//Calculates the temperature based off an ADC value
-int calculateTemp(int adcValue){
-    float voltage = (((float)adcValue/4096.0)*5.0);
-    return temperatures[(int)(voltage*10)]; //using lookup table for temperatures
-}
-
-float calculateCurrent(float adcValue){
-    float curr = (((((float)adcValue)/4095.0)*5.0) - 2.5)/0.0394;///0.04;
-    return curr;
-}
-
-float getCurrent(){
-    float currentValue = (float)adcRead((char)CSENSE);
-    currentValue = calculateCurrent(currentValue);
-       
-    return currentValue;
-}
-
-//Returns the highest temperature
-int getTemps(int temps[], int numTemps){
-    int highestTemp = 0;
-    
-    TEMPFET = 0; //Enable temperature readings
-    highestTemp = calculateTemp(adcRead(tempChannels[0])); //Read first temp sensor (TEMP1))
-    temps[0] = highestTemp; //Save value into temperature array
-    for(int inc = 0; inc < numTemps; inc ++){ //Read all of the other temp sensors
-        temps[inc] = calculateTemp(adcRead(tempChannels[inc])); //Save value into temperature array
-        if(temps[inc] > highestTemp){ //if the measured value is the highest yet, set it (high temp = lower voltage)
-            highestTemp = temps[inc];
-        }
-    }
-
-    TEMPFET = 1; //Disable temperature readings
-    return highestTemp;    //return the highest temperature
-}
-
-//reads ADC value from given channel
-int adcRead(char ch){
-    ADCON0bits.CHS = ch; //Select Channel
-    ADCON0bits.ADON = 1;
-    
-    __delay_us(100); //Wait for holding cap to charge
-    ADCON0bits.GO = 1; //Start Conversion
-    
-    while(ADCON0bits.DONE == 1);//Wait for conversion to finish
-    
-    int ansHigh = ADRESH; //Get high byte
-    int ansLow = ADRESL; //Get low byte
-    
-    int total = ((ansHigh << 4) | (ansLow >> 4) & 0x0FFF); //Calculate Total ADC Value
-    ADCON0bits.ADON = 0; 
-    return total; 
-}
-
-//Averages the ADC samples 
-float avgBuff(float buff[], int size){
-    int inc = 0;
-    float total = 0;
-    for(inc = 0; inc < size; inc++){
-        total += buff[inc];
-    }
-      
-    return ((float) total)/((float) size);
-}
-
-void adcSetup(){
-    //Setting TEMPFET pin as an output
-    TRISBbits.TRISB5 = 0;
-    
-    //Setting GPIO pins as inputs
-    TRISAbits.TRISA0 = 1; //CH0
-    TRISAbits.TRISA1 = 1; //CH1
-    TRISAbits.TRISA2 = 1; //CH2
-    TRISAbits.TRISA3 = 1; //CH3
-    
-    //Setting TEMP pins as inputs
-    TRISBbits.TRISB0 = 1; //CH12
-    TRISBbits.TRISB1 = 1; //CH10
-    TRISBbits.TRISB2 = 1; //CH8
-    TRISBbits.TRISB3 = 1; //CH9
-    TRISBbits.TRISB4 = 1; //CH11
-    
-    //Setting Current Sensor as input
-    TRISDbits.TRISD1 = 1;  //CH21
-    
-    //Enabling Analog Inputs
-    ANSELA = 0x0F; //A0, A1, A2, A3
-    ANSELB = 0x1F; //B0, B1, B2, B3, B4
-    ANSELD = 0x01; //D1
-    TRISDbits.TRISD1 = 1;  //CH21
-    WPUD = 0x00;
-    
-    //Configuration Registers
-    ADCON0 = 0x00; //12Bit, CH = AN0, ADC conversion not in progress, ADC disabled
-    ADCON1 = 0x60; //Sign-Magnitude, FOSC/16 = 32MHz/64 = 500kHz = 2uS, VREF- = Vss, VREF+ = Vdd
-    ADCON2 = 0x0F; //AutoTrigger Disabled, Negative Diff Input selected by ADNREF
+/*
+ * File:   adc.c
+ * Author: trm84
+ *
+ * Created on February 5, 2019, 1:02 PM
+ */
+#include "adc.h"
+
+//Returns the current
+
+//Calculates the temperature based off an ADC value
+int calculateTemp(int adcValue){
+    float voltage = (((float)adcValue/4096.0)*5.0);
+    return temperatures[(int)(voltage*10)]; //using lookup table for temperatures
+}
+
+//Current sensor calibration -- loaded from EEPROM on startup
+int currentOffset = CURRENT_OFFSET_NOMINAL; //ADC code at zero current
+int currentGain = CURRENT_GAIN_NOMINAL; //mA per ADC code (Q8)
+
+//Converts an ADC code to current in mA using the stored calibration
+long calculateCurrent(int adcValue){
+    return ((long)(adcValue - currentOffset) * currentGain) >> CURRENT_GAIN_SHIFT;
+}
+
+//Returns the current in mA. A burst capture owns the ADC while it runs, its
+//latest sample is used instead
+long getCurrent(){
+    int code = captureBusy() ? (int)captureLatest() : adcRead((char)CSENSE);
+    sensorUpdate(SENSOR_CURRENT, code, code); //Rail check only, the reading is always used
+    return calculateCurrent(code);
+}
+
+//Averages CURRENT_CAL_SAMPLES raw current sensor readings
+int averageCurrentCode(){
+    long total = 0;
+    for(int i = 0; i < CURRENT_CAL_SAMPLES; i++){
+        total += adcRead((char)CSENSE);
+    }
+    return (int)(total / CURRENT_CAL_SAMPLES);
+}
+
+//Loads the current sensor offset and gain from EEPROM, nominal values are
+//used until a calibration has been saved
+void loadCurrentCalibration(){
+    if(eepromRead(EE_CAL_VALID) != EE_CAL_MAGIC){
+        currentOffset = CURRENT_OFFSET_NOMINAL;
+        currentGain = CURRENT_GAIN_NOMINAL;
+        return;
+    }
+    currentOffset = (int)eepromReadWord(EE_CURRENT_OFFSET);
+    currentGain = (int)eepromReadWord(EE_CURRENT_GAIN);
+}
+
+//Zero current calibration. Must only be run while the contactors are open.
+//Returns 0 if the sensor output is too far from its midpoint to be trusted
+char calibrateCurrent(){
+    int offset = averageCurrentCode();
+    
+    if(offset < CURRENT_OFFSET_NOMINAL - CURRENT_OFFSET_LIMIT || offset > CURRENT_OFFSET_NOMINAL + CURRENT_OFFSET_LIMIT){
+        //Current Sensor Issue
+        return 0;
+    }
+    
+    currentOffset = offset;
+    eepromWriteWord(EE_CURRENT_OFFSET, (unsigned int)currentOffset); //Only written if changed
+    eepromWriteWord(EE_CURRENT_GAIN, (unsigned int)currentGain);
+    eepromWrite(EE_CAL_VALID, EE_CAL_MAGIC);
+    return 1;
+}
+
+//Gain calibration against a known reference current in mA (after calibrateCurrent)
+//Returns 0 if the reading is too close to the offset to give a usable gain
+char calibrateCurrentGain(long referenceCurrent){
+    int delta = averageCurrentCode() - currentOffset;
+    
+    if(delta > -32 && delta < 32){
+        return 0;
+    }
+    
+    long gain = (referenceCurrent << CURRENT_GAIN_SHIFT) / delta;
+    if(gain < CURRENT_GAIN_NOMINAL/2 || gain > CURRENT_GAIN_NOMINAL*2){
+        //Reference doesn't match the sensor
+        return 0;
+    }
+    
+    currentGain = (int)gain;
+    eepromWriteWord(EE_CURRENT_GAIN, (unsigned int)currentGain);
+    eepromWrite(EE_CAL_VALID, EE_CAL_MAGIC);
+    return 1;
+}
+
+//Returns the highest temperature, lowest is returned through lowestTemp.
+//Sensors that have failed their health checks are left out of both
+int getTemps(int temps[], int numTemps, int *lowestTemp){
+    int highestTemp = SENSOR_TEMP_NONE;
+    char found = 0;
+    
+    TEMPFET = 0; //Enable temperature readings
+    for(int inc = 0; inc < numTemps; inc ++){ //Read all of the temp sensors
+        int code = adcRead(tempChannels[inc]);
+        temps[inc] = sensorUpdate((char)inc, code, calculateTemp(code)); //Save value into temperature array
+        if(!sensorOk((char)inc)){
+            continue;
+        }
+        if(!found || temps[inc] > highestTemp){ //if the measured value is the highest yet, set it (high temp = lower voltage)
+            highestTemp = temps[inc];
+        }
+        if(!found || temps[inc] < *lowestTemp){
+            *lowestTemp = temps[inc];
+        }
+        found = 1;
+    }
+    if(!found){
+        *lowestTemp = SENSOR_TEMP_NONE;
+    }
+
+    TEMPFET = 1; //Disable temperature readings
+    return highestTemp;    //return the highest temperature
+}
+
+unsigned int adcTimeouts = 0; //Conversions that never finished
+
+//reads ADC value from given channel. A conversion that never finishes reads as
+//0, which the sensor checks see as a shorted thermistor or a railed current sensor
+int adcRead(char ch){
+    ADCON0bits.CHS = ch; //Select Channel
+    ADCON0bits.ADON = 1;
+    
+    __delay_us(100); //Wait for holding cap to charge
+    ADCON0bits.GO = 1; //Start Conversion
+    
+    unsigned int timeout = ADC_TIMEOUT;
+    while(ADCON0bits.DONE == 1 && --timeout);//Wait for conversion to finish
+    if(timeout == 0){
+        adcTimeouts++;
+        ADCON0bits.ADON = 0;
+        return 0;
+    }
+    
+    int ansHigh = ADRESH; //Get high byte
+    int ansLow = ADRESL; //Get low byte
+    
+    int total = ((ansHigh << 4) | (ansLow >> 4) & 0x0FFF); //Calculate Total ADC Value
+    ADCON0bits.ADON = 0; 
+    return total; 
+}
+
+//Averages the current samples 
+long avgBuff(long buff[], int size){
+    int inc = 0;
+    long total = 0;
+    for(inc = 0; inc < size; inc++){
+        total += buff[inc];
+    }
+      
+    return total / size;
+}
+
+void adcSetup(){
+    //Setting TEMPFET pin as an output
+    TRISBbits.TRISB5 = 0;
+    
+    //Setting GPIO pins as inputs
+    TRISAbits.TRISA0 = 1; //CH0
+    TRISAbits.TRISA1 = 1; //CH1
+    TRISAbits.TRISA2 = 1; //CH2
+    TRISAbits.TRISA3 = 1; //CH3
+    
+    //Setting TEMP pins as inputs
+    TRISBbits.TRISB0 = 1; //CH12
+    TRISBbits.TRISB1 = 1; //CH10
+    TRISBbits.TRISB2 = 1; //CH8
+    TRISBbits.TRISB3 = 1; //CH9
+    TRISBbits.TRISB4 = 1; //CH11
+    
+    //Setting Current Sensor as input
+    TRISDbits.TRISD1 = 1;  //CH21
+    
+    //Enabling Analog Inputs
+    ANSELA = 0x0F; //A0, A1, A2, A3
+    ANSELB = 0x1F; //B0, B1, B2, B3, B4
+    ANSELD = 0x01; //D1
+    TRISDbits.TRISD1 = 1;  //CH21
+    WPUD = 0x00;
+    
+    //Configuration Registers
+    ADCON0 = 0x00; //12Bit, CH = AN0, ADC conversion not in progress, ADC disabled
+    ADCON1 = 0x60; //Sign-Magnitude, FOSC/16 = 32MHz/64 = 500kHz = 2uS, VREF- = Vss, VREF+ = Vdd
+    ADCON2 = 0x0F; //AutoTrigger Disabled, Negative Diff Input selected by ADNREF
+    
+    loadCurrentCalibration();
 }
\ No newline at end of file
@@ -0,0 +1,29 @@
+/*
+ * File:   balance.c
+ * Author: trm84
+ *
+ * Created on October 20, 2026, 6:30 AM
+ */
+
+#include "balance.h"
+
+//Returns a bit per cell to bleed, cell 1 in bit 0. Codes are 100uV, the
+//threshold is mV
+unsigned int balanceCells(unsigned int codes[], char count, int threshold){
+    unsigned int lowest = codes[0];
+    unsigned long limit;
+    unsigned int bleed = 0;
+
+    for(unsigned char i = 1; i < count; i++){
+        if(codes[i] < lowest){
+            lowest = codes[i];
+        }
+    }
+    limit = (unsigned long)lowest + (long)threshold*10;
+    for(unsigned char i = 0; i < count; i++){
+        if(codes[i] >= limit){
+            bleed |= 1u << i;
+        }
+    }
+    return bleed;
+}
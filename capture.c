@@ -0,0 +1,135 @@
+/*
+ * File:   capture.c
+ * Author: trm84
+ *
+ * Created on October 20, 2026, 3:40 AM
+ */
+
+#include "capture.h"
+#include "adc.h"
+#include "uart.h"
+#include "telemetry.h"
+
+unsigned int capBuffer[CAPTURE_SAMPLES]; //Raw current codes
+volatile unsigned int capLatest = 0; //Last code the ISR stored
+volatile unsigned char capHead = 0; //Next slot in the ring, the oldest sample once done
+volatile unsigned char capState = CAP_IDLE; //CAP_x
+volatile unsigned char capFilled = 0; //Samples in the ring since arming, up to CAPTURE_PRE
+volatile unsigned char capRemaining = 0; //Samples still to take after the trigger
+unsigned int capHigh = 0; //Trigger codes
+unsigned int capLow = 0;
+volatile unsigned long capTime = 0; //mS at the trigger
+unsigned long capArmed = 0; //mS when armed, for CAPTURE_TIMEOUT
+long capThreshold = 0; //mA, 0 triggers at once
+unsigned char capSent = 0; //Frames sent: the info frame, then the data frames
+
+//Arms a capture that triggers when |current| (mA) reaches threshold, or as
+//soon as the pre trigger samples are in if it is 0. Returns 0 if one is
+//already running or being sent
+char captureArm(long threshold, unsigned long now){
+    if(capState != CAP_IDLE){
+        return 0;
+    }
+    if(threshold <= 0){
+        threshold = 0;
+        capHigh = 0; //Every code is a trigger
+        capLow = 0;
+    }else{
+        long delta = (threshold << CURRENT_GAIN_SHIFT) / currentGain; //Codes
+        capHigh = delta >= 4095 - currentOffset ? 4095 : (unsigned int)(currentOffset + delta);
+        capLow = delta >= currentOffset ? 0 : (unsigned int)(currentOffset - delta);
+    }
+    capThreshold = threshold;
+    capArmed = now;
+    capHead = 0;
+    capFilled = 0;
+    capSent = 0;
+
+    ADCON0bits.CHS = (char)CSENSE; //The ADC stays on the current sensor until the capture ends
+    ADCON0bits.ADON = 1;
+    __delay_us(100); //Wait for holding cap to charge
+    ADCON0bits.GO = 1; //The first tick stores this one
+    capLatest = 0;
+
+    capState = CAP_ARMED;
+    TMR2 = 0;
+    PIR1bits.TMR2IF = 0;
+    PIE1bits.TMR2IE = 1;
+    T2CONbits.TMR2ON = 1;
+    return 1;
+}
+
+//Stops a capture and hands the ADC back to the main loop
+void captureStop(){
+    T2CONbits.TMR2ON = 0;
+    PIE1bits.TMR2IE = 0;
+    ADCON0bits.ADON = 0;
+    capState = CAP_IDLE;
+}
+
+//Returns 1 while the ISR owns the ADC
+char captureBusy(){
+    return capState == CAP_ARMED || capState == CAP_TRIGGERED;
+}
+
+//Returns the last code the ISR stored. Read until two reads agree so the two
+//bytes can't come from different ticks
+unsigned int captureLatest(){
+    unsigned int code;
+    do{
+        code = capLatest;
+    }while(code != capLatest);
+    return code;
+}
+
+//Reverses part of the ring in place
+void captureReverse(unsigned char first, unsigned char last){
+    while(first < last){
+        unsigned int code = capBuffer[first];
+        capBuffer[first++] = capBuffer[last];
+        capBuffer[last--] = code;
+    }
+}
+
+//Drops a capture that never triggered, and sends a finished one a frame a
+//pass, each only once the TX ring has room for all of it. Returns 1 while
+//there are frames still to send
+char captureService(unsigned long now){
+    if(capState == CAP_ARMED && now - capArmed >= CAPTURE_TIMEOUT){
+        captureStop();
+    }
+    if(capState != CAP_DONE){
+        return 0;
+    }
+    if(capSent == 0){
+        ADCON0bits.ADON = 0;
+        if(capHead != 0){ //Rotate so the oldest sample is first, three reversals need no second buffer
+            captureReverse(0, capHead - 1);
+            captureReverse(capHead, CAPTURE_SAMPLES - 1);
+            captureReverse(0, CAPTURE_SAMPLES - 1);
+            capHead = 0;
+        }
+    }
+    if(telemetryMode() != TLM_BINARY){ //Nowhere to send it
+        captureStop();
+        return 0;
+    }
+    if(capSent == 0){
+        if(uartRoom() < TLM_CAPTURE_INFO_WIRE){
+            return 1;
+        }
+        telemetryCaptureInfo(CAPTURE_PERIOD, CAPTURE_SAMPLES, CAPTURE_PRE, capTime, currentOffset, currentGain, capThreshold);
+    }else{
+        if(uartRoom() < TLM_CAPTURE_DATA_WIRE){
+            return 1;
+        }
+        unsigned char first = (capSent - 1) * CAPTURE_CHUNK;
+        telemetryCaptureData(first, &capBuffer[first], CAPTURE_CHUNK);
+        if(first + CAPTURE_CHUNK >= CAPTURE_SAMPLES){
+            capState = CAP_IDLE;
+            return 0;
+        }
+    }
+    capSent++;
+    return 1;
+}
@@ -0,0 +1,110 @@
+/* Microchip Technology Inc. and its subsidiaries.  You may use this software
+ * and any derivatives exclusively with Microchip products.
+ *
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+ * TERMS.
+ */
+
+
+/*
+ * File: capture
+ * Author: Tyler Matthews
+ * Comments: Burst current capture for inrush and motor transients. While armed,
+ *           Timer2 interrupts every CAPTURE_PERIOD uS and the ISR stores the
+ *           last raw current conversion in a ring and starts the next one, so
+ *           the samples are evenly spaced no matter what the main loop is
+ *           doing. The trigger is |current| over a threshold, or at once for
+ *           "cap now". CAPTURE_PRE samples before the trigger are kept, the
+ *           rest of the ring fills after it, then Timer2 stops and the ring
+ *           goes out as telemetry frames:
+ *             TLM_CAPTURE_INFO 0x20  period (uS), samples, pre, trigger time
+ *                                    (mS), offset and gain (adc.h), threshold
+ *             TLM_CAPTURE_DATA 0x21  index of the first sample, up to
+ *                                    CAPTURE_CHUNK raw codes, oldest first
+ *           While armed the ADC stays on the current sensor: getCurrent() uses
+ *           the latest captured code and the temperatures hold their last
+ *           readings. A capture that hasn't triggered in CAPTURE_TIMEOUT is
+ *           dropped so the temperatures are never stale for long.
+ *           tools/cap_wave.cpp turns the frames back into a waveform.
+ *           RAM: 2*CAPTURE_SAMPLES + 12 bytes.
+ * Revision history:
+ */
+
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+//Includes
+    #include <xc.h>
+    #include "timer.h"
+
+//Defines
+    #define CAPTURE_SAMPLES 64 //Ring size, a power of 2
+    #define CAPTURE_MASK (CAPTURE_SAMPLES - 1)
+    #define CAPTURE_PRE 16 //Samples kept from before the trigger
+    #define CAPTURE_PERIOD 50 //uS between samples, a 12 bit conversion at TAD = 2uS takes ~32uS
+    #define CAPTURE_PR2 99 //Timer2 at FOSC/4/4 = 2MHz, (99 + 1) * 0.5uS = 50uS
+    #define CAPTURE_CHUNK 16 //Samples per data frame
+    #define CAPTURE_TIMEOUT 5000 //mS armed without a trigger before giving up
+
+    #define CAP_IDLE 0 //States
+    #define CAP_ARMED 1 //Filling the ring, waiting for the trigger
+    #define CAP_TRIGGERED 2 //Filling the samples after the trigger
+    #define CAP_DONE 3 //Ring frozen, being sent
+
+    //Stores the conversion that finished since the last tick and starts the
+    //next one, called from the ISR on every Timer2 match. The channel is never
+    //changed while armed so the holding cap tracks between conversions
+    #define CAPTURE_TICK() do{ \
+        PIR1bits.TMR2IF = 0; \
+        capLatest = ((unsigned int)ADRESH << 4) | (ADRESL >> 4); \
+        ADCON0bits.GO = 1; \
+        capBuffer[capHead] = capLatest; \
+        capHead = (capHead + 1) & CAPTURE_MASK; \
+        if(capState == CAP_ARMED){ \
+            if(capFilled < CAPTURE_PRE){ \
+                capFilled++; \
+            }else if(capLatest >= capHigh || capLatest <= capLow){ \
+                capState = CAP_TRIGGERED; \
+                capRemaining = CAPTURE_SAMPLES - CAPTURE_PRE - 1; \
+                capTime = millis; \
+            } \
+        }else if(--capRemaining == 0){ \
+            T2CONbits.TMR2ON = 0; \
+            PIE1bits.TMR2IE = 0; \
+            capState = CAP_DONE; \
+        } \
+    }while(0)
+
+//Prototypes
+    char captureArm(long threshold, unsigned long now);
+    void captureStop();
+    char captureBusy();
+    unsigned int captureLatest();
+    char captureService(unsigned long now);
+
+//Variables
+    extern unsigned int capBuffer[CAPTURE_SAMPLES]; //Raw current codes
+    extern volatile unsigned int capLatest; //Last code the ISR stored
+    extern volatile unsigned char capHead; //Next slot in the ring, the oldest sample once done
+    extern volatile unsigned char capState; //CAP_x
+    extern volatile unsigned char capFilled; //Samples in the ring since arming, up to CAPTURE_PRE
+    extern volatile unsigned char capRemaining; //Samples still to take after the trigger
+    extern unsigned int capHigh; //Trigger codes
+    extern unsigned int capLow;
+    extern volatile unsigned long capTime; //mS at the trigger
+
+#endif
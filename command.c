@@ -0,0 +1,273 @@
+/*
+ * File:   command.c
+ * Author: trm84
+ *
+ * Created on October 20, 2026, 1:10 AM
+ */
+
+#include "command.h"
+#include "uart.h"
+#include "format.h"
+#include "telemetry.h"
+#include "console.h"
+#include "fault.h"
+#include "ltc6804.h"
+#include "adc.h"
+#include "trace.h"
+#include "timer.h"
+#include "capture.h"
+
+//Fault rows are in FAULT_x bit order (fault.h)
+const commandParam commandParams[] = {
+    {"balance", CMD_VALUE, &balanceThreshold, 0, 5, 500}, //mV
+    {"ot", CMD_FAULT, 0, 0, 30, 70}, //Over temperature, C
+    {"ht", CMD_FAULT, 0, 1, 25, 65}, //High temperature warning, C
+    {"ut", CMD_FAULT, 0, 2, -20, 20}, //Under temperature, C
+    {"oc", CMD_FAULT, 0, 3, 1000, 30000}, //Discharge over current, mA
+    {"occ", CMD_FAULT, 0, 4, 500, 20000}, //Charge over current, mA
+    {"ov", CMD_FAULT, 0, 5, 3600, 4300}, //Cell over voltage, mV
+    {"uv", CMD_FAULT, 0, 6, 2500, 3500}, //Cell under voltage, mV
+};
+#define CMD_PARAMS (sizeof(commandParams) / sizeof(commandParams[0]))
+
+//Telemetry channels in TLM_CH_x order (telemetry.h)
+const char *const commandChannels[TLM_CHANNELS] = {"current", "sop", "minmax", "soc", "faults", "temps", "cells", "status", "loop"};
+
+char cmdLine[CMD_LENGTH + 1]; //Line being received
+unsigned char cmdLength = 0;
+char cmdTooLong = 0; //Set once the line has run past CMD_LENGTH, it is thrown away
+char cmdOverflow = 0; //Set once received bytes were lost, everything up to the next line end is thrown away
+unsigned int cmdDropped = 0; //uartRxDropped when it was last checked
+unsigned char cmdRequests = 0; //CMD_x bits for main from the last command
+
+//Reads what has arrived and runs at most one command. Returns CMD_x requests
+//for main to act on
+unsigned char commandService(long current, char contactorsOpen){
+    int c;
+    cmdRequests = 0;
+    while((c = uartRead()) >= 0){
+        if(uartRxDropped != cmdDropped){ //The ring filled, the lost bytes may have been this line's CR
+            cmdDropped = uartRxDropped;
+            cmdOverflow = 1;
+        }
+        if(c != '\r' && c != '\n'){
+            if(cmdLength < CMD_LENGTH){
+                cmdLine[cmdLength++] = (char)c;
+            }else{
+                cmdTooLong = 1;
+            }
+            continue;
+        }
+        if(cmdLength == 0 && !cmdTooLong && !cmdOverflow){
+            continue; //Blank line, or the LF of a CRLF
+        }
+        cmdLine[cmdLength] = '\0';
+        if(cmdOverflow){
+            commandReply("err overflow", 0, 0, 0);
+        }else if(cmdTooLong){
+            commandReply("err too long", 0, 0, 0);
+        }else{
+            commandRun(cmdLine, current, contactorsOpen);
+        }
+        cmdLength = 0;
+        cmdTooLong = 0;
+        cmdOverflow = 0;
+        break; //The rest waits for the next pass
+    }
+    return cmdRequests;
+}
+
+//Compares a word with a name
+char commandIs(const char *word, const char *name){
+    int i = 0;
+    while(word[i] == name[i]){
+        if(word[i] == '\0'){
+            return 1;
+        }
+        i++;
+    }
+    return 0;
+}
+
+//Splits off the next space separated word, returns the rest of the line
+char *commandWord(char *line, char **word){
+    while(*line == ' '){
+        line++;
+    }
+    *word = line;
+    while(*line != ' ' && *line != '\0'){
+        line++;
+    }
+    if(*line == ' '){
+        *line++ = '\0';
+    }
+    return line;
+}
+
+//Parses a signed decimal number. Returns 0 if the word isn't one
+char commandNumber(const char *word, long *value){
+    char negative = word[0] == '-';
+    int i = negative ? 1 : 0;
+    long result = 0;
+    if(word[i] == '\0'){
+        return 0;
+    }
+    for(; word[i] != '\0'; i++){
+        if(word[i] < '0' || word[i] > '9' || result > 100000){
+            return 0;
+        }
+        result = result*10 + (word[i] - '0');
+    }
+    *value = negative ? -result : result;
+    return 1;
+}
+
+//Finds a parameter by name, returns CMD_PARAMS if there is none
+unsigned char commandFind(const char *name){
+    unsigned char p = 0;
+    while(p < CMD_PARAMS && !commandIs(name, commandParams[p].name)){
+        p++;
+    }
+    return p;
+}
+
+int commandGet(unsigned char p){
+    if(commandParams[p].kind == CMD_FAULT){
+        return faultLimit(commandParams[p].fault);
+    }
+    return *commandParams[p].value;
+}
+
+void commandSet(unsigned char p, int value){
+    if(commandParams[p].kind == CMD_FAULT){
+        faultSetLimit(commandParams[p].fault, value);
+    }else{
+        *commandParams[p].value = value;
+    }
+}
+
+//Runs one command line and replies to it
+void commandRun(char *line, long current, char contactorsOpen){
+    char *command;
+    char *arg;
+    char *valueWord;
+    long value;
+
+    line = commandWord(line, &command);
+    line = commandWord(line, &arg);
+    commandWord(line, &valueWord);
+
+    if(commandIs(command, "get") || commandIs(command, "set")){
+        unsigned char p = commandFind(arg);
+        if(p >= CMD_PARAMS){
+            commandReply("err no param", 0, 0, 0);
+            return;
+        }
+        if(command[0] == 's'){
+            if(!commandNumber(valueWord, &value)){
+                commandReply("err bad value", 0, 0, 0);
+                return;
+            }
+            if(value < commandParams[p].min || value > commandParams[p].max){
+                commandReply("err range", 0, 0, 0);
+                return;
+            }
+            commandSet(p, (int)value);
+        }
+        commandReply("ok", commandParams[p].name, commandGet(p), 1);
+    }else if(commandIs(command, "params")){
+        char text[CMD_REPLY];
+        int length = formatText(text, "ok");
+        for(unsigned char p = 0; p < CMD_PARAMS; p++){
+            text[length++] = ' ';
+            length += formatText(&text[length], commandParams[p].name);
+        }
+        text[length] = '\0';
+        commandReply(text, 0, 0, 0);
+    }else if(commandIs(command, "snap")){
+        if(telemetryMode() == TLM_ASCII){
+            consoleRepaint();
+        }
+        cmdRequests |= CMD_SNAPSHOT;
+        commandReply("ok", 0, 0, 0);
+    }else if(commandIs(command, "sub")){
+        char ch = 0;
+        while(ch < TLM_CHANNELS && !commandIs(arg, commandChannels[ch])){
+            ch++;
+        }
+        if(ch >= TLM_CHANNELS){
+            commandReply("err no channel", 0, 0, 0);
+        }else if(!commandNumber(valueWord, &value) || value < 0){
+            commandReply("err bad value", 0, 0, 0);
+        }else if((value != 0 && value < TLM_MIN_PERIOD) || value > TLM_MAX_PERIOD){
+            commandReply("err period", 0, 0, 0);
+        }else if(!telemetrySubscribe(ch, (unsigned int)value, getMillis())){
+            commandReply("err budget", "load", telemetryLoad(), 1);
+        }else{
+            commandReply("ok", "load", telemetryLoad(), 1);
+        }
+    }else if(commandIs(command, "key")){
+        telemetryKey();
+        commandReply("ok", 0, 0, 0);
+    }else if(commandIs(command, "stream") && (commandIs(arg, "on") || commandIs(arg, "off"))){
+        telemetryStream(arg[1] == 'n');
+        commandReply("ok", 0, 0, 0);
+    }else if(commandIs(command, "mode") && commandIs(arg, "ascii")){
+        telemetrySetMode(TLM_ASCII);
+        consoleRepaint();
+        commandReply("ok", 0, 0, 0);
+    }else if(commandIs(command, "mode") && commandIs(arg, "binary")){
+        telemetrySetMode(TLM_BINARY);
+        commandReply("ok", 0, 0, 0);
+    }else if(commandIs(command, "trace")){
+        traceDump(); //Polled, ~10mS, ends up between two frames or console updates
+        commandReply("ok", 0, 0, 0);
+    }else if(commandIs(command, "cap")){
+        if(commandIs(arg, "off")){
+            captureStop();
+            commandReply("ok", 0, 0, 0);
+        }else if(telemetryMode() != TLM_BINARY){
+            commandReply("err mode", 0, 0, 0);
+        }else if(!commandIs(arg, "now") && (!commandNumber(arg, &value) || value < 1 || value > 60000)){
+            commandReply("err bad value", 0, 0, 0);
+        }else if(!captureArm(commandIs(arg, "now") ? 0 : value, getMillis())){
+            commandReply("err busy", 0, 0, 0);
+        }else{
+            commandReply("ok", 0, 0, 0);
+        }
+    }else if(commandIs(command, "cal")){
+        if(captureBusy()){
+            commandReply("err capture", 0, 0, 0);
+        }else if(!contactorsOpen){ //Closed, the load and charger currents would be zeroed out with the sensor's offset
+            commandReply("err contactor closed", 0, 0, 0);
+        }else if(current > CMD_CAL_CURRENT || current < -CMD_CAL_CURRENT){
+            commandReply("err current flowing", 0, 0, 0);
+        }else if(!calibrateCurrent()){
+            commandReply("err offset", 0, 0, 0);
+        }else{
+            commandReply("ok", 0, 0, 0);
+        }
+    }else if(commandIs(command, "reset")){
+        faultReset();
+        commandReply("ok", 0, 0, 0);
+    }else{
+        commandReply("err unknown", 0, 0, 0);
+    }
+}
+
+//Sends a reply line: text, then name and value if withValue is set
+void commandReply(const char *text, const char *name, long value, char withValue){
+    char reply[CMD_REPLY];
+    int length = formatText(reply, text);
+    if(withValue){
+        reply[length++] = ' ';
+        length += formatText(&reply[length], name);
+        reply[length++] = ' ';
+        length += formatSigned(&reply[length], value);
+    }
+    if(telemetryMode() == TLM_BINARY){
+        telemetryReply(reply, length);
+    }else{
+        consoleMessage(reply, length);
+    }
+}
@@ -0,0 +1,79 @@
+/* Microchip Technology Inc. and its subsidiaries.  You may use this software
+ * and any derivatives exclusively with Microchip products.
+ *
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+ * TERMS.
+ */
+
+/*
+ * File: command
+ * Author: Tyler Matthews
+ * Comments: Command interface on the UART RX line. The RX ISR only moves
+ *           bytes into a ring. Lines are parsed and run from the main loop
+ *           after the measurements, one command a pass, so a command can
+ *           never hold up a sample. If the RX ring fills, the line the
+ *           lost bytes belonged to is thrown away up to its line end and
+ *           answered "err overflow", so two lines never run together.
+ *           Commands, one per line (CR or LF):
+ *             get <param>          set <param> <value>      params
+ *             snap                 stream on|off            mode ascii|binary
+ *             trace                cal                      reset
+ *             sub <channel> <ms>   (channels: current sop minmax soc
+ *                                   faults temps cells status loop, 0 mS
+ *                                   is off, 10-32767 mS otherwise)
+ *             cap <mA>|now|off     burst current capture, binary mode only
+ *             key                  next cells frame is a key frame
+ *           cal zeroes the current sensor and saves the offset, so it is
+ *           refused unless both contactors are open and the pack is at rest.
+ *           Every command gets one reply line starting "ok" or "err". In
+ *           binary mode it goes out as a TLM_REPLY frame, in ASCII mode on
+ *           the console's message line. tools/bms_cmd.cpp sends commands
+ *           and prints the replies. A sub reply carries the link load in
+ *           bytes/S, "err budget" if the new rate would not fit. Tuned values are not saved, a reset
+ *           goes back to the defaults.
+ * Revision history:
+ */
+
+#ifndef COMMAND_H
+#define COMMAND_H
+
+//Defines
+    #define CMD_LENGTH 24 //Longest command line
+    #define CMD_REPLY 40 //Longest reply
+    #define CMD_CAL_CURRENT 500 //mA, zeroing the current sensor is refused above this even with the contactors open
+
+    #define CMD_VALUE 0 //Parameter kinds: an int in RAM
+    #define CMD_FAULT 1 //A fault's set threshold
+
+    #define CMD_SNAPSHOT 0x01 //Requests back to main
+
+//Variables
+    typedef struct{
+        const char *name;
+        char kind; //CMD_x
+        int *value; //CMD_VALUE
+        char fault; //CMD_FAULT, row in the fault table
+        int min;
+        int max;
+    }commandParam;
+
+//Prototypes
+    unsigned char commandService(long current, char contactorsOpen);
+    void commandRun(char *line, long current, char contactorsOpen);
+    void commandReply(const char *text, const char *name, long value, char withValue);
+
+#endif
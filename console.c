@@ -0,0 +1,254 @@
+/*
+ * File:   console.c
+ * Author: trm84
+ *
+ * Created on October 19, 2026, 11:30 PM
+ */
+
+#include "console.h"
+#include "uart.h"
+#include "format.h"
+#include "timer.h"
+
+const char * const conLabels[CON_ROWS] = {
+    " V1       V   V2       V   V3       V   V4       V",
+    " V5       V   V6       V   V7       V   V8       V",
+    " V9       V  V10       V  V11       V  V12       V",
+    "Pack        V   Spread       V   Balancing 0x",
+    "Temps     C     C     C     C     C   Highest     C",
+    "Current         A   SOC       %   EKF SOC       %",
+#if ISR_PROFILE
+    "EKF cycles         ISR load      %   Max IR      uOhm V",
+#else
+    "EKF cycles         ISR load   n/a    Max IR      uOhm V",
+#endif
+    "SOP 2S      A dis      A chg   10S      A dis      A chg",
+    "SOH      %   Cycles         Throughput       Ah        Wh",
+    "DoD cycles",
+    "Faults 0x       Latched 0x       Actions 0x     Sensors 0x",
+    "dT/dt      C/min   dV/dt      mV/min",
+    "Reset            Late 0x     Timeouts         Overflows"
+};
+
+const consoleField conFields[CON_FIELDS] = {
+    {1, 5, 6, CON_DEC, 4},
+    {1, 18, 6, CON_DEC, 4},
+    {1, 31, 6, CON_DEC, 4},
+    {1, 44, 6, CON_DEC, 4},
+    {2, 5, 6, CON_DEC, 4},
+    {2, 18, 6, CON_DEC, 4},
+    {2, 31, 6, CON_DEC, 4},
+    {2, 44, 6, CON_DEC, 4},
+    {3, 5, 6, CON_DEC, 4},
+    {3, 18, 6, CON_DEC, 4},
+    {3, 31, 6, CON_DEC, 4},
+    {3, 44, 6, CON_DEC, 4},
+    {4, 6, 7, CON_DEC, 4},
+    {4, 24, 6, CON_DEC, 4},
+    {4, 46, 3, CON_HEX, 0},
+    {5, 7, 4, CON_DEC, 0},
+    {5, 13, 4, CON_DEC, 0},
+    {5, 19, 4, CON_DEC, 0},
+    {5, 25, 4, CON_DEC, 0},
+    {5, 31, 4, CON_DEC, 0},
+    {5, 47, 4, CON_DEC, 0},
+    {6, 9, 8, CON_DEC, 3},
+    {6, 25, 6, CON_DEC, 2},
+    {6, 43, 6, CON_DEC, 2},
+    {7, 12, 5, CON_DEC, 0},
+    {7, 29, 5, CON_DEC, 1},
+    {7, 45, 5, CON_DEC, 0},
+    {7, 56, 2, CON_DEC, 0},
+    {8, 8, 5, CON_DEC, 1},
+    {8, 36, 5, CON_DEC, 1},
+    {8, 19, 5, CON_DEC, 1},
+    {8, 47, 5, CON_DEC, 1},
+    {9, 5, 5, CON_DEC, 1},
+    {9, 21, 5, CON_DEC, 0},
+    {9, 40, 6, CON_DEC, 0},
+    {9, 49, 7, CON_DEC, 0},
+    {10, 12, 5, CON_DEC, 0},
+    {10, 18, 5, CON_DEC, 0},
+    {10, 24, 5, CON_DEC, 0},
+    {10, 30, 5, CON_DEC, 0},
+    {10, 36, 5, CON_DEC, 0},
+    {11, 10, 4, CON_HEX, 0},
+    {11, 27, 4, CON_HEX, 0},
+    {11, 44, 2, CON_HEX, 0},
+    {11, 59, 2, CON_HEX, 0},
+    {12, 7, 5, CON_DEC, 0},
+    {12, 26, 5, CON_DEC, 0},
+    {13, 7, 8, CON_NAME, 0},
+    {13, 25, 2, CON_HEX, 0},
+    {13, 39, 5, CON_DEC, 0},
+    {13, 57, 5, CON_DEC, 0}
+};
+
+const char * const resetNames[] = {"POR", "BOR", "WDT", "MCLR", "STACK", "SOFTWARE"}; //RESET_x order in watchdog.h
+
+unsigned int conLast[CON_FIELDS]; //Value last drawn in each field, folded to 16 bits
+unsigned char conDrawn[(CON_FIELDS + 7) / 8]; //Bit per field once conLast is on screen
+char conRow = 0; //Next label row to draw, CON_ROWS once the screen is up
+char conStart = 0; //First field this refresh looks at
+char conNext = 0; //Where the next refresh starts, 0 after a refresh that got everything out
+char conFull = 0; //Set once a field didn't fit this refresh
+unsigned char conRefreshes = 0; //Refreshes since the last full repaint
+
+//Clears the terminal and redraws every label and field over the next refreshes
+void consoleRepaint(){
+    conRow = 0;
+    conNext = 0;
+    conRefreshes = 0;
+    for(int i = 0; i < sizeof(conDrawn); i++){
+        conDrawn[i] = 0;
+    }
+}
+
+//Writes the escape sequence that puts the cursor at row, col (1 based)
+int consoleCursor(char *out, unsigned char row, unsigned char col){
+    int length = formatText(out, "\033[");
+    length += formatUnsigned(&out[length], row);
+    out[length++] = ';';
+    length += formatUnsigned(&out[length], col);
+    out[length++] = 'H';
+    return length;
+}
+
+//Draws the labels a row at a time while they fit in the ring. Returns 1 once
+//the whole screen is up
+char consoleLabels(){
+    while(conRow < CON_ROWS){
+        int length = 0;
+        if(conRow == 0){
+            length = formatText(str, "\033[2J"); //Clear screen
+        }
+        length += consoleCursor(&str[length], conRow + 1, 1);
+        length += formatText(&str[length], conLabels[conRow]);
+        if(length > uartRoom()){
+            return 0;
+        }
+        uartQueue((unsigned char *)str, length);
+        conRow++;
+    }
+    return 1;
+}
+
+//Formats the cursor move and a field's value, right aligned in its width, into
+//str. Returns the length
+int consoleFormat(char field, long value){
+    const consoleField *f = &conFields[field];
+    int length = consoleCursor(str, f->row, f->col);
+
+    if(f->format == CON_HEX){
+        length += formatHex(&str[length], value, f->width);
+    }else if(f->format == CON_NAME){
+        int end = length + f->width;
+        length += formatText(&str[length], resetNames[value]);
+        while(length < end){ //Blank whatever the last name left behind
+            str[length++] = ' ';
+        }
+    }else{
+        length += formatPadded(&str[length], value, f->decimals, f->width);
+    }
+    return length;
+}
+
+//Redraws a field if its value has changed since it was drawn. A field that
+//doesn't fit in the ring is left for the next refresh
+void consoleSet(char field, long value){
+    unsigned int fold = (unsigned int)value ^ (unsigned int)(value >> 16);
+    unsigned char bit = 1 << (field & 7);
+
+    if(conFull || field < conStart){
+        return; //Out of room, or drawn last refresh so the rest go first
+    }
+    if((conDrawn[field >> 3] & bit) && conLast[field] == fold){
+        return;
+    }
+    int length = consoleFormat(field, value);
+    if(length > uartRoom()){
+        conFull = 1;
+        conNext = field;
+        return;
+    }
+    uartQueue((unsigned char *)str, length);
+    conLast[field] = fold;
+    conDrawn[field >> 3] |= bit;
+}
+
+//Draws whatever changed since the last refresh. Call every CONSOLE_PERIOD
+void consoleRefresh(unsigned int codes[], int balanceEn[], int temps[], int highestTemp, long current, int soc, int ekfSoc, unsigned int ekfCycles, unsigned int isrLoad, unsigned int irMax, int irCell, long sopLimits[], unsigned int health, unsigned int cycles, unsigned long throughput, unsigned long energy, unsigned int dodCycles[], unsigned int faults, unsigned int latched, unsigned char actions, unsigned char sensors, int tempSlope, int cellSlope, char reset, unsigned char late, unsigned int timeouts, unsigned int overflows){
+    long pack = 0;
+    unsigned int balance = 0;
+    unsigned int minCode = codes[0];
+    unsigned int maxCode = codes[0];
+
+    if(++conRefreshes >= CONSOLE_REPAINT){
+        consoleRepaint();
+    }
+    if(!consoleLabels()){
+        return;
+    }
+    conStart = conNext;
+    conNext = 0;
+    conFull = 0;
+
+    for(int i = 0; i < 12; i++){
+        pack += codes[i];
+        if(codes[i] < minCode){
+            minCode = codes[i];
+        }else if(codes[i] > maxCode){
+            maxCode = codes[i];
+        }
+        if(balanceEn[i]){
+            balance |= 1 << i;
+        }
+        consoleSet(CON_CELL + i, codes[i]);
+    }
+    consoleSet(CON_PACK, pack);
+    consoleSet(CON_SPREAD, maxCode - minCode);
+    consoleSet(CON_BALANCE, balance);
+    for(int i = 0; i < 5; i++){
+        consoleSet(CON_TEMP + i, temps[i]);
+    }
+    consoleSet(CON_TEMP_HIGH, highestTemp);
+    consoleSet(CON_CURRENT, current);
+    consoleSet(CON_SOC, soc);
+    consoleSet(CON_EKF_SOC, ekfSoc);
+    consoleSet(CON_EKF_CYCLES, ekfCycles);
+#if ISR_PROFILE
+    consoleSet(CON_ISR_LOAD, isrLoad);
+#endif
+    consoleSet(CON_IR, irMax);
+    consoleSet(CON_IR_CELL, irCell + 1);
+    for(int i = 0; i < 4; i++){
+        consoleSet(CON_SOP + i, sopLimits[i] / 100);
+    }
+    consoleSet(CON_SOH, health);
+    consoleSet(CON_CYCLES, cycles);
+    consoleSet(CON_THROUGHPUT, throughput / 1000);
+    consoleSet(CON_ENERGY, energy / 1000);
+    for(int i = 0; i < 5; i++){
+        consoleSet(CON_DOD + i, dodCycles[i]);
+    }
+    consoleSet(CON_FAULTS, faults);
+    consoleSet(CON_LATCHED, latched);
+    consoleSet(CON_ACTIONS, actions);
+    consoleSet(CON_SENSORS, sensors);
+    consoleSet(CON_TEMP_SLOPE, tempSlope);
+    consoleSet(CON_CELL_SLOPE, cellSlope);
+    consoleSet(CON_RESET, reset);
+    consoleSet(CON_LATE, late);
+    consoleSet(CON_TIMEOUTS, timeouts);
+    consoleSet(CON_OVERFLOWS, overflows);
+}
+
+//Shows a line of text, ie: a command reply, under the fields
+void consoleMessage(const char *text, int length){
+    int used = consoleCursor(str, CON_MESSAGE_ROW, 1);
+    for(int i = 0; i < length && used < UART_STR_SIZE - 3; i++){
+        str[used++] = text[i];
+    }
+    used += formatText(&str[used], "\033[K"); //Clear the rest of the last message
+    uartWrite((unsigned char *)str, used);
+}
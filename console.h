@@ -0,0 +1,97 @@
+/* Microchip Technology Inc. and its subsidiaries.  You may use this software
+ * and any derivatives exclusively with Microchip products.
+ *
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+ * TERMS.
+ */
+
+/*
+ * File: console
+ * Author: Tyler Matthews
+ * Comments: Terminal dashboard. The labels are drawn once and every value
+ *           has a fixed spot on the screen, so a refresh only moves the
+ *           cursor to the fields that changed and rewrites those. The last
+ *           value drawn in each field is kept to tell. Fields that don't fit
+ *           in the TX ring wait for the next refresh, which starts where the
+ *           last one ran out so none are starved.
+ * Revision history:
+ */
+
+#ifndef CONSOLE_H
+#define CONSOLE_H
+
+//Defines
+    #define CONSOLE_PERIOD 100 //mS between refreshes
+    #define CONSOLE_REPAINT 100 //Refreshes between full repaints (10S), picks up a terminal opened late
+    #define CON_ROWS 13
+    #define CON_MESSAGE_ROW (CON_ROWS + 2) //Command replies go under the fields
+
+    //Field formats
+    #define CON_DEC 0 //Signed fixed point, decimals digits after the point, right aligned
+    #define CON_HEX 1 //Width hex digits
+    #define CON_NAME 2 //Index into resetNames
+
+    //Fields, in screen order
+    #define CON_CELL 0 //x12, 100uV
+    #define CON_PACK 12 //100uV
+    #define CON_SPREAD 13 //100uV
+    #define CON_BALANCE 14 //Bit per cell
+    #define CON_TEMP 15 //x5, C
+    #define CON_TEMP_HIGH 20 //C
+    #define CON_CURRENT 21 //mA
+    #define CON_SOC 22 //0.01%
+    #define CON_EKF_SOC 23 //0.01%
+    #define CON_EKF_CYCLES 24
+    #define CON_ISR_LOAD 25 //0.1%, only drawn with ISR_PROFILE (timer.h)
+    #define CON_IR 26 //uOhm
+    #define CON_IR_CELL 27
+    #define CON_SOP 28 //x4 as sopLimits, 0.1A
+    #define CON_SOH 32 //0.1%
+    #define CON_CYCLES 33
+    #define CON_THROUGHPUT 34 //Ah
+    #define CON_ENERGY 35 //Wh
+    #define CON_DOD 36 //x5
+    #define CON_FAULTS 41
+    #define CON_LATCHED 42
+    #define CON_ACTIONS 43
+    #define CON_SENSORS 44
+    #define CON_TEMP_SLOPE 45 //C/min
+    #define CON_CELL_SLOPE 46 //mV/min
+    #define CON_RESET 47
+    #define CON_LATE 48
+    #define CON_TIMEOUTS 49
+    #define CON_OVERFLOWS 50
+    #define CON_FIELDS 51
+
+//Variables
+    typedef struct{
+        unsigned char row; //1 based, as the terminal counts
+        unsigned char col;
+        unsigned char width; //Characters the field owns, the rest are blanked
+        unsigned char format; //CON_x
+        unsigned char decimals; //CON_DEC only
+    }consoleField;
+
+//Prototypes
+    void consoleRepaint();
+    void consoleRefresh(unsigned int codes[], int balanceEn[], int temps[], int highestTemp, long current, int soc, int ekfSoc, unsigned int ekfCycles, unsigned int isrLoad, unsigned int irMax, int irCell, long sopLimits[], unsigned int health, unsigned int cycles, unsigned long throughput, unsigned long energy, unsigned int dodCycles[], unsigned int faults, unsigned int latched, unsigned char actions, unsigned char sensors, int tempSlope, int cellSlope, char reset, unsigned char late, unsigned int timeouts, unsigned int overflows);
+    void consoleSet(char field, long value);
+    int consoleCursor(char *out, unsigned char row, unsigned char col);
+    int consoleFormat(char field, long value);
+    void consoleMessage(const char *text, int length);
+
+#endif
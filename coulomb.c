@@ -0,0 +1,67 @@
+/*
+ * File:   coulomb.c
+ * Author: trm84
+ *
+ * Created on October 19, 2026, 11:05 AM
+ */
+
+#include "coulomb.h"
+
+long capacityCharge = 0; //Pack capacity in mA*s
+long socStep = 1; //mA*s per 0.01% of SOC
+long charge = 0; //Remaining charge in mA*s
+long chargeRemainder = 0; //Sub mA*s charge in mA*mS, always between -999 and 999
+
+//Sets the capacity (mA*s) and the starting SOC (0.01%)
+void coulombInit(long capacity, int soc){
+    capacityCharge = capacity;
+    socStep = capacity / SOC_FULL;
+    if(socStep < 1){
+        socStep = 1;
+    }
+    coulombSetSoc(soc);
+}
+
+//Integrates one current sample (mA) over the time since the last sample (mS)
+void coulombUpdate(long current, unsigned long dt){
+    if(dt > COULOMB_MAX_DT){
+        dt = COULOMB_MAX_DT;
+    }
+
+    chargeRemainder -= current * (long)dt; //mA*mS, discharge is positive current
+    charge += chargeRemainder / 1000; //Carry whole mA*s
+    chargeRemainder = chargeRemainder % 1000;
+
+    if(charge > capacityCharge){ //Can't hold more than full
+        charge = capacityCharge;
+        chargeRemainder = 0;
+    }else if(charge < 0){
+        charge = 0;
+        chargeRemainder = 0;
+    }
+}
+
+//Moves the counter to a known SOC (0.01%) ie: from a rested open circuit voltage
+void coulombSetSoc(int soc){
+    if(soc < 0){
+        soc = 0;
+    }else if(soc > SOC_FULL){
+        soc = SOC_FULL;
+    }
+    charge = (long)soc * socStep;
+    chargeRemainder = 0;
+}
+
+//Returns the SOC in 0.01% steps
+int coulombSoc(){
+    long soc = charge / socStep;
+    if(soc > SOC_FULL){
+        soc = SOC_FULL;
+    }
+    return (int)soc;
+}
+
+//Returns the remaining charge in mA*s
+long coulombCharge(){
+    return charge;
+}
@@ -0,0 +1,46 @@
+/* Microchip Technology Inc. and its subsidiaries.  You may use this software
+ * and any derivatives exclusively with Microchip products.
+ *
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+ * TERMS.
+ */
+
+/*
+ * File: coulomb
+ * Author: Tyler Matthews
+ * Comments: Coulomb counter. Every current sample is integrated against the
+ *           time since the previous sample, all in integer math. Charge is
+ *           held as whole mA*s plus a mA*mS remainder so nothing is lost to
+ *           rounding. Positive current is discharge.
+ * Revision history:
+ */
+
+#ifndef COULOMB_H
+#define COULOMB_H
+
+//Defines
+    #define SOC_FULL 10000 //SOC is reported in 0.01% steps
+    #define COULOMB_MAX_DT 30000 //mS, longer gaps are clamped so the product can't overflow
+
+//Prototypes
+    void coulombInit(long capacity, int soc);
+    void coulombUpdate(long current, unsigned long dt);
+    void coulombSetSoc(int soc);
+    int coulombSoc();
+    long coulombCharge();
+
+#endif
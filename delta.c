@@ -0,0 +1,120 @@
+/*
+ * File:   delta.c
+ * Author: trm84
+ *
+ * Created on October 20, 2026, 5:05 AM
+ */
+
+#include "delta.h"
+
+//Zigzag, written without shifts of negative numbers so it reads the same on
+//the 16 bit PIC and a 32 bit host
+unsigned int deltaZigzag(int value){
+    return value < 0 ? ((unsigned int)(-value) << 1) - 1 : (unsigned int)value << 1;
+}
+
+int deltaUnzigzag(unsigned int value){
+    return (value & 1) ? -(int)(value >> 1) - 1 : (int)(value >> 1);
+}
+
+//Codes values against reference into out, using no more than limit bytes.
+//Returns the length, or 0 if a change is too big or it doesn't fit, in
+//which case the caller sends a key block. Reference becomes values on success
+int deltaEncode(unsigned int values[], unsigned int reference[], unsigned char count, unsigned char out[], int limit){
+    int length = 0;
+    char high = 1; //Next nibble goes in the high half of a new byte
+    long sum = 0;
+    int mean;
+    unsigned int z;
+
+    for(unsigned char i = 0; i < count; i++){
+        int change = (int)(values[i] - reference[i]);
+        if(change > DELTA_MAX_CHANGE || change < -DELTA_MAX_CHANGE){
+            return 0;
+        }
+        sum += change;
+    }
+    mean = (int)(sum / count);
+
+    z = deltaZigzag(mean);
+    do{
+        if(length >= limit){
+            return 0;
+        }
+        out[length++] = (z & 0x7F) | (z > 0x7F ? 0x80 : 0);
+        z >>= 7;
+    }while(z != 0);
+
+    for(unsigned char i = 0; i < count; i++){
+        z = deltaZigzag((int)(values[i] - reference[i]) - mean);
+        do{
+            unsigned char nibble = (z & 0x07) | (z > 0x07 ? 0x08 : 0);
+            z >>= 3;
+            if(high){
+                if(length >= limit){
+                    return 0;
+                }
+                out[length++] = nibble << 4;
+            }else{
+                out[length - 1] |= nibble;
+            }
+            high = !high;
+        }while(z != 0);
+    }
+
+    for(unsigned char i = 0; i < count; i++){
+        reference[i] = values[i];
+    }
+    return length;
+}
+
+//Walks a coded block, adding the changes to reference if apply is set.
+//Returns the bytes used, or 0 if the block is short or malformed
+int deltaWalk(const unsigned char in[], int length, unsigned int reference[], unsigned char count, char apply){
+    int used = 0;
+    char high = 1;
+    unsigned int z = 0;
+    unsigned char shift = 0;
+    unsigned char nibble;
+    int mean;
+
+    do{
+        if(used >= length || shift > 14){
+            return 0;
+        }
+        z |= (unsigned int)(in[used] & 0x7F) << shift;
+        shift += 7;
+    }while(in[used++] & 0x80);
+    mean = deltaUnzigzag(z);
+
+    for(unsigned char i = 0; i < count; i++){
+        z = 0;
+        shift = 0;
+        do{
+            if(high){
+                if(used >= length || shift > 15){
+                    return 0;
+                }
+                nibble = in[used++] >> 4;
+            }else{
+                nibble = in[used - 1] & 0x0F;
+            }
+            high = !high;
+            z |= (unsigned int)(nibble & 0x07) << shift;
+            shift += 3;
+        }while(nibble & 0x08);
+        if(apply){
+            reference[i] += (unsigned int)(deltaUnzigzag(z) + mean);
+        }
+    }
+    return used;
+}
+
+//Applies a coded block to reference. Returns the bytes used, or 0 if the
+//block is short or malformed, in which case reference is left alone
+int deltaDecode(const unsigned char in[], int length, unsigned int reference[], unsigned char count){
+    if(deltaWalk(in, length, reference, count, 0) == 0){
+        return 0;
+    }
+    return deltaWalk(in, length, reference, count, 1);
+}
@@ -0,0 +1,51 @@
+/* Microchip Technology Inc. and its subsidiaries.  You may use this software
+ * and any derivatives exclusively with Microchip products.
+ *
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+ * TERMS.
+ */
+
+
+/*
+ * File: delta
+ * Author: Tyler Matthews
+ * Comments: Delta coding for slowly changing readings like the cell codes.
+ *           A block is coded against the previous block the caller keeps:
+ *             the mean change, zigzag varint in 7 bit groups
+ *             each reading's change less the mean, zigzag varint in 3 bit
+ *             groups packed two to a byte, high nibble first
+ *           Zigzag maps 0, -1, 1, -2 ... to 0, 1, 2, 3 ... so small changes
+ *           of either sign stay short. The cells of a pack move together
+ *           with the current, the mean takes that out and what is left is
+ *           mostly ADC noise, a nibble or two each. A quiet pack codes 12
+ *           cells in 7-9 bytes in place of 24.
+ *           No module state, the caller owns the reference block, so the
+ *           telemetry stream and a log can each keep their own.
+ * Revision history:
+ */
+
+#ifndef DELTA_H
+#define DELTA_H
+
+//Defines
+    #define DELTA_MAX_CHANGE 8191 //Codes, a bigger change needs a key block
+
+//Prototypes
+    int deltaEncode(unsigned int values[], unsigned int reference[], unsigned char count, unsigned char out[], int limit);
+    int deltaDecode(const unsigned char in[], int length, unsigned int reference[], unsigned char count);
+
+#endif
@@ -0,0 +1,66 @@
+/*
+ * File:   eeprom.c
+ * Author: trm84
+ *
+ * Created on October 19, 2026, 10:12 AM
+ */
+
+#include <xc.h>
+#include "eeprom.h"
+
+//Reads one byte from data EEPROM
+unsigned char eepromRead(unsigned char addr){
+    EEADRL = addr; //Select Address
+    EECON1bits.CFGS = 0; //Data EEPROM, not config space
+    EECON1bits.EEPGD = 0; //Data EEPROM, not program memory
+    EECON1bits.RD = 1; //Start Read -- data is available next cycle
+    return EEDATL;
+}
+
+//Writes one byte to data EEPROM. Skips the write if the byte already matches
+//so callers can save freely without wearing out the cell
+void eepromWrite(unsigned char addr, unsigned char data){
+    if(eepromRead(addr) == data){
+        return;
+    }
+
+    while(EECON1bits.WR == 1); //Wait for previous write to finish
+
+    EEADRL = addr; //Select Address
+    EEDATL = data; //Data to write
+    EECON1bits.CFGS = 0; //Data EEPROM, not config space
+    EECON1bits.EEPGD = 0; //Data EEPROM, not program memory
+    EECON1bits.WREN = 1; //Allow writes
+
+    char gie = INTCONbits.GIE;
+    INTCONbits.GIE = 0; //Unlock sequence can not be interrupted
+    EECON2 = 0x55;
+    EECON2 = 0xAA;
+    EECON1bits.WR = 1; //Start Write
+    INTCONbits.GIE = gie;
+
+    EECON1bits.WREN = 0; //Lock writes
+    while(EECON1bits.WR == 1); //Wait for write to finish (~4mS)
+}
+
+//Reads a little endian word
+unsigned int eepromReadWord(unsigned char addr){
+    return ((unsigned int)eepromRead(addr + 1) << 8) | eepromRead(addr);
+}
+
+//Writes a little endian word
+void eepromWriteWord(unsigned char addr, unsigned int data){
+    eepromWrite(addr, (unsigned char)(data & 0xFF));
+    eepromWrite(addr + 1, (unsigned char)(data >> 8));
+}
+
+//Reads a little endian long
+unsigned long eepromReadLong(unsigned char addr){
+    return ((unsigned long)eepromReadWord(addr + 2) << 16) | eepromReadWord(addr);
+}
+
+//Writes a little endian long
+void eepromWriteLong(unsigned char addr, unsigned long data){
+    eepromWriteWord(addr, (unsigned int)(data & 0xFFFF));
+    eepromWriteWord(addr + 2, (unsigned int)(data >> 16));
+}
@@ -0,0 +1,59 @@
+/* Microchip Technology Inc. and its subsidiaries.  You may use this software
+ * and any derivatives exclusively with Microchip products.
+ *
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+ * TERMS.
+ */
+
+/*
+ * File: eeprom
+ * Author: Tyler Matthews
+ * Comments: Data EEPROM (256 bytes) holds calibration and values that must
+ *           survive a reset. Every address used lives in the map below.
+ * Revision history:
+ */
+
+#ifndef EEPROM_H
+#define EEPROM_H
+
+//Defines -- EEPROM Map
+    #define EE_CAL_VALID 0x00 //Holds EE_CAL_MAGIC once the current calibration has been written
+    #define EE_CURRENT_OFFSET 0x01 //2 bytes: zero current ADC code
+    #define EE_CURRENT_GAIN 0x03 //2 bytes: mA per ADC code (Q8)
+    #define EE_SOH_VALID 0x05 //Holds EE_SOH_MAGIC once the SOH block has been written
+    #define EE_SOH_CAPACITY 0x06 //2 bytes: measured capacity (mAh)
+    #define EE_SOH_THROUGHPUT 0x08 //4 bytes: lifetime charge in and out (mAh)
+    #define EE_SOH_DISCHARGED 0x0C //4 bytes: lifetime charge out (mAh)
+    #define EE_SOH_ENERGY 0x10 //4 bytes: lifetime energy in and out (mWh)
+    #define EE_RF_VALID 0x14 //Holds EE_RF_MAGIC once the rainflow histogram has been written
+    #define EE_RF_HIST 0x15 //40 bytes: rainflow half cycles, 5 DoD x 4 mean SOC bins of 2 bytes (to 0x3C)
+    #define EE_RESET_REASON 0x3D //Why the part last reset (RESET_x in watchdog.h)
+    #define EE_RESET_COUNTS 0x3E //6 bytes: resets per reason (to 0x43)
+
+    #define EE_CAL_MAGIC 0xA5
+    #define EE_SOH_MAGIC 0x5A
+    #define EE_RF_MAGIC 0xC3
+
+//Prototypes
+    unsigned char eepromRead(unsigned char addr);
+    void eepromWrite(unsigned char addr, unsigned char data);
+    unsigned int eepromReadWord(unsigned char addr);
+    void eepromWriteWord(unsigned char addr, unsigned int data);
+    unsigned long eepromReadLong(unsigned char addr);
+    void eepromWriteLong(unsigned char addr, unsigned long data);
+
+#endif
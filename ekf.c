@@ -0,0 +1,103 @@
+/*
+ * File:   ekf.c
+ * Author: trm84
+ *
+ * Created on October 19, 2026, 3:20 PM
+ */
+
+#include "ekf.h"
+#include "ocv.h"
+#include "coulomb.h"
+
+long ekfCapacity = 0; //mA*s
+long ekfSocStep = 1; //mA*s per 0.01% of SOC
+long ekfCharge = 0; //State 1: remaining charge in mA*s
+long ekfV1 = 0; //State 2: RC pair voltage in 0.1mV
+long p11 = EKF_P11_INIT, p12 = 0, p22 = EKF_P22_INIT; //Covariance
+
+//Sets the capacity (mA*s) and starting SOC (0.01%)
+void ekfInit(long capacity, int soc){
+    ekfCapacity = capacity;
+    ekfSocStep = capacity / SOC_FULL;
+    if(ekfSocStep < 16){
+        ekfSocStep = 16;
+    }
+    ekfCharge = (long)soc * ekfSocStep;
+    ekfV1 = 0;
+    p11 = EKF_P11_INIT;
+    p12 = 0;
+    p22 = EKF_P22_INIT;
+}
+
+//One predict/correct step.
+//deltaCharge: charge change since the last update from the coulomb counter (mA*s)
+//current: average current over the step (mA, discharge positive)
+//cellVoltage: average cell voltage (0.1mV)
+//dt: time since the last update (mS)
+void ekfUpdate(long deltaCharge, long current, unsigned int cellVoltage, unsigned long dt){
+    long a, h1, predicted, e, pht1, pht2, s, k1, k2;
+    unsigned int slope;
+    int soc;
+    
+    /*PREDICT*/
+    if(dt > EKF_MAX_DT){
+        dt = EKF_MAX_DT;
+    }
+    a = 32768 - (long)((dt << 15) / EKF_TAU); //exp(-dt/tau), Q15
+    
+    ekfCharge += deltaCharge;
+    if(ekfCharge > ekfCapacity){
+        ekfCharge = ekfCapacity;
+    }else if(ekfCharge < 0){
+        ekfCharge = 0;
+    }
+    ekfV1 = ((a * ekfV1) + ((32768 - a) * ((EKF_R1 * current) / 100))) >> 15;
+    
+    p11 += EKF_Q11;
+    if(p11 > EKF_P11_INIT){
+        p11 = EKF_P11_INIT;
+    }
+    p12 = (a * p12) >> 15;
+    p22 = ((((a * a) >> 15) * p22) >> 15) + EKF_Q22;
+    
+    /*CORRECT*/
+    soc = (int)(ekfCharge / ekfSocStep);
+    predicted = (long)socToOcv(soc, &slope) * 10 - ekfV1 - ((EKF_R0 * current) / 100);
+    h1 = ((long)slope << 8) / 100; //dOCV/dSOC in 0.1mV per 0.01%, Q8
+    
+    e = (long)cellVoltage - predicted;
+    if(e > EKF_E_MAX){
+        e = EKF_E_MAX;
+    }else if(e < -EKF_E_MAX){
+        e = -EKF_E_MAX;
+    }
+    
+    pht1 = ((h1 * p11) >> 8) - p12; //P*H' with H = [h1, -1]
+    pht2 = ((h1 * p12) >> 8) - p22;
+    s = ((h1 * pht1) >> 8) - pht2 + EKF_R; //H*P*H' + R
+    k1 = (pht1 << 10) / s; //Q10
+    k2 = (pht2 << 10) / s;
+    
+    ekfCharge += ((k1 * e) * (ekfSocStep >> 4)) >> 6; //k1*e is 0.01% in Q10
+    if(ekfCharge > ekfCapacity){
+        ekfCharge = ekfCapacity;
+    }else if(ekfCharge < 0){
+        ekfCharge = 0;
+    }
+    ekfV1 += (k2 * e) >> 10;
+    
+    p11 -= (k1 * pht1) >> 10; //P = (I - K*H)*P
+    p12 -= (k1 * pht2) >> 10;
+    p22 -= (k2 * pht2) >> 10;
+    if(p11 < 1){
+        p11 = 1;
+    }
+    if(p22 < 1){
+        p22 = 1;
+    }
+}
+
+//Returns the estimated SOC in 0.01% steps
+int ekfSoc(){
+    return (int)(ekfCharge / ekfSocStep);
+}
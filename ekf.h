@@ -0,0 +1,68 @@
+/* Microchip Technology Inc. and its subsidiaries.  You may use this software
+ * and any derivatives exclusively with Microchip products.
+ *
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+ * TERMS.
+ */
+
+/*
+ * File: ekf
+ * Author: Tyler Matthews
+ * Comments: Extended Kalman filter SOC estimator on a one RC equivalent
+ *           circuit of the average cell: V = OCV(SOC) - V1 - R0*I.
+ *           States are SOC (held as charge in mA*s) and the RC voltage V1.
+ *           Fixed point throughout:
+ *             SOC for the covariance is in 0.01%, voltages are in 0.1mV,
+ *             gains are Q10, H1 (dOCV/dSOC) is Q8, the RC decay is Q15.
+ *           Every intermediate is bounded to fit a signed long by the limits
+ *           below. One update is 18 long multiplies and 8 long divides, the
+ *           OCV lookup included, with no data dependent loops. Worst case is
+ *           budgeted at EKF_MAX_CYCLES
+ *           (XC8 -O0: ~350 cycles per multiply, ~1100 per divide, plus the
+ *           OCV lookup and bookkeeping). That is counted on the host, not
+ *           timed: main times every update with Timer1 and shows the worst
+ *           as EKF cycles on the console, check it there before leaning on
+ *           the budget.
+ *           Started 20% off on tools/ekf_bench.cpp's drive cycle it is
+ *           within 2% SOC from ~41 minutes on, ~1% RMS after that.
+ * Revision history:
+ */
+
+#ifndef EKF_H
+#define EKF_H
+
+//Defines
+    #define EKF_R0 10 //mOhm, series resistance of one cell group
+    #define EKF_R1 8 //mOhm, RC pair resistance
+    #define EKF_TAU 30000 //mS, RC pair time constant (R1*C1)
+    #define EKF_MAX_DT 7500 //mS, keeps the first order RC decay (1 - dt/tau) accurate
+
+    #define EKF_Q11 1 //SOC process noise per update, (0.01%)^2
+    #define EKF_Q22 4 //V1 process noise per update, (0.1mV)^2
+    #define EKF_R 10000 //Measurement noise, (10mV)^2 in (0.1mV)^2
+    #define EKF_P11_INIT 250000 //(5% SOC)^2 -- also the cap that keeps the math in range
+    #define EKF_P22_INIT 10000 //(10mV)^2
+    #define EKF_E_MAX 500 //0.1mV, residual is clamped to 50mV so a bad reading can't throw the state
+
+    #define EKF_MAX_CYCLES 18000 //Worst case instruction cycles per update (~2.3mS at 8MIPS), counted by tools/ekf_bench.cpp
+
+//Prototypes
+    void ekfInit(long capacity, int soc);
+    void ekfUpdate(long deltaCharge, long current, unsigned int cellVoltage, unsigned long dt);
+    int ekfSoc();
+
+#endif
@@ -0,0 +1,123 @@
+/*
+ * File:   fault.c
+ * Author: trm84
+ *
+ * Created on October 19, 2026, 6:00 PM
+ */
+
+#include "fault.h"
+#include "sensor.h"
+
+typedef struct{
+    char source; //FAULT_SRC_x
+    char direction; //FAULT_ABOVE or FAULT_BELOW
+    int set; //Threshold to set
+    int clear; //Threshold to clear, the gap is the hysteresis
+    unsigned char setCount; //Ticks in a row past set before it sets
+    unsigned char clearCount; //Ticks in a row past clear before it clears
+    char severity; //FAULT_WARNING or FAULT_CRITICAL
+    unsigned char action; //FAULT_WARN, FAULT_DERATE, FAULT_OPEN_x bits
+}faultEntry;
+
+//One row per fault bit, ticks are current samples (one per main loop pass)
+const faultEntry faultTable[FAULT_COUNT] = {
+    {FAULT_SRC_TEMP_MAX, FAULT_ABOVE, 40, 37, 20, 200, FAULT_CRITICAL, FAULT_OPEN_DISCHARGE | FAULT_OPEN_CHARGE}, //Over temperature
+    {FAULT_SRC_TEMP_MAX, FAULT_ABOVE, 35, 33, 20, 200, FAULT_WARNING, FAULT_DERATE}, //High temperature
+    {FAULT_SRC_TEMP_MIN, FAULT_BELOW, 10, 12, 20, 200, FAULT_WARNING, FAULT_OPEN_DISCHARGE | FAULT_OPEN_CHARGE}, //Under temperature
+    {FAULT_SRC_DISCHARGE, FAULT_ABOVE, 10000, 9000, 20, 200, FAULT_CRITICAL, FAULT_OPEN_DISCHARGE}, //Over current
+    {FAULT_SRC_CHARGE, FAULT_ABOVE, 6000, 5000, 20, 200, FAULT_CRITICAL, FAULT_OPEN_CHARGE}, //Charge over current
+    {FAULT_SRC_CELL_MAX, FAULT_ABOVE, 4250, 4150, 5, 200, FAULT_CRITICAL, FAULT_OPEN_CHARGE}, //Cell over voltage
+    {FAULT_SRC_CELL_MIN, FAULT_BELOW, 2900, 3100, 5, 200, FAULT_CRITICAL, FAULT_OPEN_DISCHARGE}, //Cell under voltage
+    {FAULT_SRC_TEMP_SENSORS, FAULT_ABOVE, 1, 0, 1, 1, FAULT_WARNING, FAULT_WARN | FAULT_DERATE}, //A thermistor is out, the sensor layer has debounced it
+    {FAULT_SRC_TEMP_SENSORS, FAULT_ABOVE, SENSOR_TEMPS_LOST, SENSOR_TEMPS_LOST - 1, 1, 1, FAULT_CRITICAL, FAULT_OPEN_DISCHARGE | FAULT_OPEN_CHARGE}, //Too few thermistors left to see the pack
+    {FAULT_SRC_CURRENT_SENSOR, FAULT_ABOVE, 1, 0, 1, 1, FAULT_CRITICAL, FAULT_OPEN_DISCHARGE | FAULT_OPEN_CHARGE}, //No over current protection without it
+    {FAULT_SRC_RUNAWAY, FAULT_ABOVE, 1, 0, 1, 255, FAULT_WARNING, FAULT_WARN | FAULT_DERATE}, //Early warning, holds the derate a while after the trend goes away
+};
+
+int faultInputs[FAULT_SOURCES];
+int faultSets[FAULT_COUNT]; //Working copy of the set thresholds, tunable at run time
+int faultClears[FAULT_COUNT];
+unsigned char faultCounts[FAULT_COUNT]; //Debounce count toward the next state change
+unsigned int faultBits = 0; //Active faults
+unsigned int faultLatch = 0; //Critical faults that have set since the last reset
+unsigned char faultAct = 0; //OR of the actions of active faults
+
+//Loads the thresholds from the table
+void faultInit(){
+    for(int i = 0; i < FAULT_COUNT; i++){
+        faultSets[i] = faultTable[i].set;
+        faultClears[i] = faultTable[i].clear;
+    }
+}
+
+//Moves a fault's set threshold, the clear threshold follows so the hysteresis
+//stays what the table gives it
+void faultSetLimit(char fault, int set){
+    faultClears[fault] = set + (faultTable[fault].clear - faultTable[fault].set);
+    faultSets[fault] = set;
+}
+
+//Returns a fault's set threshold
+int faultLimit(char fault){
+    return faultSets[fault];
+}
+
+//Updates one source
+void faultInput(char source, int value){
+    faultInputs[source] = value;
+}
+
+//Runs every table entry once. Returns the actions to apply
+unsigned char faultTick(){
+    unsigned int bit = 1;
+    unsigned char actions = 0;
+
+    for(int i = 0; i < FAULT_COUNT; i++){
+        int value = faultInputs[faultTable[i].source];
+        char past; //Past the threshold that would change the state
+        if(faultBits & bit){
+            past = faultTable[i].direction == FAULT_ABOVE ? value <= faultClears[i] : value >= faultClears[i];
+            past = past && !(faultLatch & bit); //Latched faults hold
+        }else{
+            past = faultTable[i].direction == FAULT_ABOVE ? value >= faultSets[i] : value <= faultSets[i];
+        }
+
+        if(!past){
+            faultCounts[i] = 0;
+        }else if(++faultCounts[i] >= ((faultBits & bit) ? faultTable[i].clearCount : faultTable[i].setCount)){
+            faultCounts[i] = 0;
+            faultBits ^= bit;
+            if((faultBits & bit) && faultTable[i].severity == FAULT_CRITICAL){
+                faultLatch |= bit;
+            }
+        }
+
+        if(faultBits & bit){
+            actions |= faultTable[i].action;
+        }
+        bit <<= 1;
+    }
+
+    faultAct = actions;
+    return actions;
+}
+
+//Returns the active fault bits
+unsigned int faultActive(){
+    return faultBits;
+}
+
+//Returns the latched critical fault bits
+unsigned int faultLatched(){
+    return faultLatch;
+}
+
+//Returns the actions from the last tick
+unsigned char faultActions(){
+    return faultAct;
+}
+
+//Releases latched faults, they clear normally once back inside the clear threshold
+void faultReset(){
+    faultLatch = 0;
+}
@@ -0,0 +1,89 @@
+/* Microchip Technology Inc. and its subsidiaries.  You may use this software
+ * and any derivatives exclusively with Microchip products.
+ *
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+ * TERMS.
+ */
+
+/*
+ * File: fault
+ * Author: Tyler Matthews
+ * Comments: Table driven fault engine. Each entry watches one source against
+ *           a set threshold and a clear threshold (the hysteresis), and has
+ *           to see FAULT_SET/clear counts in a row before it changes state.
+ *           Critical faults latch until faultReset(). Every tick walks the
+ *           whole table with no early exits so the cost is fixed.
+ *           Active faults are one bit each, the actions of all active
+ *           faults are OR'd together for the caller to apply.
+ * Revision history:
+ */
+
+#ifndef FAULT_H
+#define FAULT_H
+
+//Defines -- Sources, fed with faultInput() before each faultTick()
+    #define FAULT_SRC_CELL_MAX 0 //mV
+    #define FAULT_SRC_CELL_MIN 1 //mV
+    #define FAULT_SRC_TEMP_MAX 2 //C
+    #define FAULT_SRC_TEMP_MIN 3 //C
+    #define FAULT_SRC_DISCHARGE 4 //mA, discharge current
+    #define FAULT_SRC_CHARGE 5 //mA, charge current
+    #define FAULT_SRC_TEMP_SENSORS 6 //Failed thermistors
+    #define FAULT_SRC_CURRENT_SENSOR 7 //1 if the current sensor has failed
+    #define FAULT_SRC_RUNAWAY 8 //1 while dT/dt and dV/dt both point at thermal runaway
+    #define FAULT_SOURCES 9
+
+//Defines -- Direction
+    #define FAULT_ABOVE 0 //Sets at or above the threshold
+    #define FAULT_BELOW 1 //Sets at or below the threshold
+
+//Defines -- Severity
+    #define FAULT_WARNING 0 //Clears on its own
+    #define FAULT_CRITICAL 1 //Latched until faultReset()
+
+//Defines -- Actions, bits
+    #define FAULT_WARN 0x01 //Report only
+    #define FAULT_DERATE 0x02 //Cut the power limits
+    #define FAULT_OPEN_DISCHARGE 0x04
+    #define FAULT_OPEN_CHARGE 0x08
+
+//Defines -- Fault bits, in table order
+    #define FAULT_OVER_TEMP 0x0001
+    #define FAULT_HIGH_TEMP 0x0002
+    #define FAULT_UNDER_TEMP 0x0004
+    #define FAULT_OVER_CURRENT 0x0008
+    #define FAULT_CHARGE_CURRENT 0x0010
+    #define FAULT_OVER_VOLTAGE 0x0020
+    #define FAULT_UNDER_VOLTAGE 0x0040
+    #define FAULT_TEMP_SENSOR 0x0080
+    #define FAULT_TEMP_SENSORS_LOST 0x0100
+    #define FAULT_CURRENT_SENSOR 0x0200
+    #define FAULT_RUNAWAY_WARNING 0x0400
+    #define FAULT_COUNT 11
+
+//Prototypes
+    void faultInit();
+    void faultSetLimit(char fault, int set);
+    int faultLimit(char fault);
+    void faultInput(char source, int value);
+    unsigned char faultTick();
+    unsigned int faultActive();
+    unsigned int faultLatched();
+    unsigned char faultActions();
+    void faultReset();
+
+#endif
@@ -0,0 +1,98 @@
+/*
+ * File:   format.c
+ * Author: trm84
+ *
+ * Created on October 20, 2026, 12:15 AM
+ */
+
+#include "format.h"
+
+const unsigned long formatPowers[FORMAT_DIGITS] = {1000000000, 100000000, 10000000, 1000000, 100000, 10000, 1000, 100, 10, 1};
+const char formatHexDigits[] = "0123456789ABCDEF";
+
+//Writes value in decimal with a point before the last decimals digits,
+//ie: 37012 with 4 decimals is 3.7012. There is always a digit before the point
+int formatFixed(char *out, long value, char decimals){
+    int length = 0;
+    unsigned long u = (unsigned long)value;
+    char started = 0;
+
+    if(value < 0){
+        out[length++] = '-';
+        u = 0 - u; //Two's complement, safe for the most negative value too
+    }
+    for(unsigned char p = 0; p < FORMAT_DIGITS; p++){
+        char place = FORMAT_DIGITS - 1 - p; //0 is the units digit
+        char digit = '0';
+        while(u >= formatPowers[p]){ //At most 9 subtractions a digit
+            u -= formatPowers[p];
+            digit++;
+        }
+        if(digit != '0' || place <= decimals){
+            started = 1;
+        }
+        if(started){
+            if(decimals > 0 && place == decimals - 1){
+                out[length++] = '.';
+            }
+            out[length++] = digit;
+        }
+    }
+    return length;
+}
+
+int formatUnsigned(char *out, unsigned long value){
+    int length = 0;
+    char started = 0;
+    for(unsigned char p = 0; p < FORMAT_DIGITS; p++){
+        char digit = '0';
+        while(value >= formatPowers[p]){
+            value -= formatPowers[p];
+            digit++;
+        }
+        if(digit != '0' || p == FORMAT_DIGITS - 1){
+            started = 1;
+        }
+        if(started){
+            out[length++] = digit;
+        }
+    }
+    return length;
+}
+
+int formatSigned(char *out, long value){
+    return formatFixed(out, value, 0);
+}
+
+//Right aligns a fixed point value in width characters. Longer values are
+//written in full rather than cut
+int formatPadded(char *out, long value, char decimals, char width){
+    char digits[FORMAT_MAX];
+    int used = formatFixed(digits, value, decimals);
+    int length = 0;
+    while(length < width - used){
+        out[length++] = ' ';
+    }
+    for(int i = 0; i < used; i++){
+        out[length++] = digits[i];
+    }
+    return length;
+}
+
+//Writes the low digits nibbles of value with leading zeros
+int formatHex(char *out, unsigned long value, char digits){
+    for(unsigned char d = 0; d < digits; d++){
+        out[d] = formatHexDigits[(value >> (4*(digits - 1 - d))) & 0x0F];
+    }
+    return digits;
+}
+
+//Copies text without its terminator
+int formatText(char *out, const char *text){
+    int length = 0;
+    while(text[length] != '\0'){
+        out[length] = text[length];
+        length++;
+    }
+    return length;
+}
@@ -0,0 +1,50 @@
+/* Microchip Technology Inc. and its subsidiaries.  You may use this software
+ * and any derivatives exclusively with Microchip products.
+ *
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+ * TERMS.
+ */
+
+/*
+ * File: format
+ * Author: Tyler Matthews
+ * Comments: Integer number formatting, in place of sprintf. Every routine
+ *           writes straight into the caller's buffer and returns the length
+ *           written, with no terminator. Decimal digits come from
+ *           subtracting powers of ten, so there is no division and no float
+ *           anywhere. That keeps doprnt and the float library out of flash.
+ *           tools/format_bench.cpp checks the output against printf on the
+ *           host and times both.
+ * Revision history:
+ */
+
+#ifndef FORMAT_H
+#define FORMAT_H
+
+//Defines
+    #define FORMAT_DIGITS 10 //Decimal digits in an unsigned long
+    #define FORMAT_MAX 12 //Longest number: sign, 10 digits and the point
+
+//Prototypes
+    int formatUnsigned(char *out, unsigned long value);
+    int formatSigned(char *out, long value);
+    int formatFixed(char *out, long value, char decimals);
+    int formatPadded(char *out, long value, char decimals, char width);
+    int formatHex(char *out, unsigned long value, char digits);
+    int formatText(char *out, const char *text);
+
+#endif
@@ -0,0 +1,62 @@
+/*
+ * File:   ir.c
+ * Author: trm84
+ *
+ * Created on October 19, 2026, 2:40 PM
+ */
+
+#include "ir.h"
+
+unsigned int cellIr[IR_CELLS]; //Running average per cell in uOhm, 0 until the first step
+unsigned int prevCodes[IR_CELLS]; //Previous sweep
+long prevCurrent = 0; //Current during the previous sweep (mA)
+unsigned long prevTime = 0; //Time of the previous sweep (mS)
+char prevValid = 0;
+
+//Call once per cell sweep with the current sampled during that sweep
+void irUpdate(unsigned int codes[], long current, unsigned long now){
+    long dI = current - prevCurrent; //Discharge is positive, so a load step is positive dI and negative dV
+
+    if(prevValid && now - prevTime <= IR_MAX_GAP && (dI >= IR_STEP_CURRENT || dI <= -IR_STEP_CURRENT)){
+        for(int i = 0; i < IR_CELLS; i++){
+            long dV = (long)prevCodes[i] - codes[i];
+            if(codes[i] == 0 || prevCodes[i] == 0 || dV > IR_MAX_DV || dV < -IR_MAX_DV){
+                continue; //Cell not connected or a glitch
+            }
+
+            long r = dV * 100000 / dI; //100uV / mA = 0.1 Ohm -> uOhm
+            if(r < IR_MIN || r > IR_MAX){
+                continue;
+            }
+
+            if(cellIr[i] == 0){ //First step seeds the estimate
+                cellIr[i] = (unsigned int)r;
+            }else{
+                cellIr[i] = (unsigned int)(cellIr[i] + (r - (long)cellIr[i]) / IR_AVERAGE);
+            }
+        }
+    }
+
+    for(int i = 0; i < IR_CELLS; i++){
+        prevCodes[i] = codes[i];
+    }
+    prevCurrent = current;
+    prevTime = now;
+    prevValid = 1;
+}
+
+//Returns the estimate for one cell in uOhm, 0 if it hasn't seen a step yet
+unsigned int irGet(int cell){
+    return cellIr[cell];
+}
+
+//Returns the highest resistance (weakest cell) and its index
+unsigned int irMax(int *cell){
+    *cell = 0;
+    for(int i = 1; i < IR_CELLS; i++){
+        if(cellIr[i] > cellIr[*cell]){
+            *cell = i;
+        }
+    }
+    return cellIr[*cell];
+}
@@ -0,0 +1,51 @@
+/* Microchip Technology Inc. and its subsidiaries.  You may use this software
+ * and any derivatives exclusively with Microchip products.
+ *
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+ * TERMS.
+ */
+
+/*
+ * File: ir
+ * Author: Tyler Matthews
+ * Comments: Online cell internal resistance estimate. Each cell sweep is
+ *           paired with a current sample taken while the LTC6804 converts.
+ *           When the current steps by IR_STEP_CURRENT between two sweeps
+ *           close enough together that only the ohmic drop has moved, every
+ *           cell gets R = -dV/dI folded into a running average.
+ *           Resistances are in uOhm, voltages are raw LTC6804 codes (100uV).
+ * Revision history:
+ */
+
+#ifndef IR_H
+#define IR_H
+
+//Defines
+    #define IR_CELLS 12
+    #define IR_STEP_CURRENT 2000 //mA, smaller steps are lost in the noise
+    #define IR_MAX_GAP 500 //mS between sweeps, longer and the RC pair starts to move
+    #define IR_MAX_DV 5000 //Codes (0.5V), also keeps dV*100000 inside a long
+    #define IR_MIN 500 //uOhm, anything outside IR_MIN..IR_MAX is a bad reading
+    #define IR_MAX 60000 //uOhm
+    #define IR_AVERAGE 8 //Each step moves the estimate 1/8 of the way
+
+//Prototypes
+    void irUpdate(unsigned int codes[], long current, unsigned long now);
+    unsigned int irGet(int cell);
+    unsigned int irMax(int *cell);
+
+#endif
@@ -1,263 +1,377 @@
-/*
- *  File:   main.c
- *  Author: Tyler Matthews
- */
-
-//Includes
-    #include <xc.h>
-    #include "timer.h"
-    #include "ltc6804.h"
-    #include "adc.h"
-    #include "uart.h"
-    #include "i2c.h"
-    #include "spi.h"
-    #include "SSD1306.h"
-    #include "config.h"
-
-//Defines
-    #define FOSC 32000000
-    #define FCY 32000000/2
-    #define NUM_TEMPS 5
-    #define NUM_CURRENT 20
-    #define NUM_VOLTAGES 12
-    #define MAX_VOLTAGE 50.4 //Battery Pack at 100% charge
-    #define MIN_VOLTAGE 38.4 //Battery Pack at 0% charge
-    #define CAPACITY 12 //Ahr
-    #define DISCHARGE_EN LATDbits.LATD5 //Discharge Enable Pin
-    #define CHARGE_EN  LATDbits.LATD4 //Charge Enable Pin
-    #define CHARGE_SWITCH PORTAbits.RA0
-    #define UART_LINES 25
-    #define TEST_LED LATAbits.LATA5
-
-//Prototypes
-    void setup();
-    int startUp(int *highestTemp, int temps[], float voltages[], float *totalVoltage, float *current, float *soc);
-    char running();
-    
-//Global Variables
-    int j = 0, k = 0 , z = 0; //incrementing variables
-    int uartBool = 0; //Timer  enabled bool to write to UART for testing
-    int currentBool = 0; //Measuring Current bool
-
-//Main
-void main(void){    
-    int balanceEn[NUM_VOLTAGES]; //Keep track of cells that are being balanced
-    
-    float voltages[NUM_VOLTAGES]; //Voltages
-    float totalVoltage; //Total Voltage
-    
-    int currentIndex = 0; //Index for current buffer
-    float currentBuff[NUM_CURRENT]; //Buffer to store current values
-    float current = 0; //Current 
-    
-    int temps[NUM_TEMPS] = {20, 20, 20, 20, 20}; //Temperatures
-    int highestTemp; //Highest Temperature
-
-    int numFaults = 0; //Number of faults
-    float soc = 0; //SOC Percentage out of 100
-    
-    const unsigned int total_capacity = CAPACITY*3600; //A-s
-    setup();
-    
-    __delay_ms(1000); //start delay
-    
-    //DISCHARGE_EN = 0; //Defaults to charge and discharge circuits being off
-    //CHARGE_EN = startUp(&highestTemp, temps, voltages, &totalVoltage, &current, &soc); 
-    DISCHARGE_EN = startUp(&highestTemp, temps, voltages, &totalVoltage, &current, &soc);
-    DISCHARGE_EN = 1;
-    /* Design for charging circuit went belly up -- might bodge it in
-    if(CHARGE_SWITCH == 1 ){
-        CHARGE_EN = startUp(highestTemp);   //If startup check is okay, enable charging
-    }else{
-        DISCHARGE_EN = startUp(highestTemp);               //If startup check is okay, enable discharging
-    }
-    */
-
-    
-    while(1){
-        
-       // while(running());
-       // while(!(running()));
-        TEST_LED ^= 1;
-        
-        /*MEASUREMENTS*/
-        //VOLTAGE
-       //
-        measureVoltages(voltages, &totalVoltage, NUM_VOLTAGES); // Voltages 
-        //TEMPERATURE
-        highestTemp = getTemps(temps, NUM_TEMPS); // Temperatures
-        //CURRENT
-         if(currentBool == 1){ //Add current to buffer
-            currentBuff[currentIndex] = getCurrent();
-            currentIndex ++;
-            if(currentIndex >= NUM_CURRENT){ //Average buffer to get finalized current value
-                current = avgBuff(currentBuff, currentIndex);
-                
-                soc = ((((soc)*(float)total_capacity) - (current/500))/((float)(total_capacity)));
-                
-                currentIndex = 0;
-            }
-            currentBool = 0;
-        }
-        /*END MEASUREMENTS*/
-        
-        /*FAULT CHECKING*/
-        //TEMPERATURE 
-       for(int i = 0; i <NUM_TEMPS; i++){
-            if(temps[i] >= 40 || temps[i] <= 10){
-                numFaults++;
-            }
-        }
-        //CURRENT
-        if(current >= 10){
-            numFaults++;
-        }
-        //VOLTAGES
-        /**********/
-        //COUNT FAULTS
-        if(numFaults >= 10){
-            DISCHARGE_EN = 0;
-        }
-        /*END FAULT CHECKING*/
-        
-       /*WRITE DATA TO DISP*/
-        //UART
-        if(uartBool == 1){ //UART
-            cellBalancing(voltages, NUM_VOLTAGES, balanceEn); //Balance the cells
-            writeValuesToUart(voltages, NUM_VOLTAGES, totalVoltage, balanceEn, temps, NUM_TEMPS, highestTemp, current, soc, UART_LINES);
-            uartBool = 0;
-        }
-        //I2C
-        /**********/
-        /*END WRITING DATA TO DISPLAY*/
-    }
-}
-
-/******************************************************************************/
-//int startup()
-//Run once on start up. Ensures that batteries are in a safe
-//operating condition prior to initial startup. Then calculates initial soc
-//to give column counting algorithm an accurate start point
-/******************************************************************************/
-int startUp(int *highestTemp, int temps[], float voltages[], float *totalVoltage, float *current, float *soc){
-    measureVoltages(voltages, totalVoltage, NUM_VOLTAGES);
-    for(int i = 0; i < NUM_VOLTAGES; i++){
-        if(voltages[i] > 4.2 || voltages[i] < 3.1){
-            //Batteries are over or under charged
-            return 0;
-        }
-    }
-    *totalVoltage = sumVoltages(voltages, NUM_VOLTAGES); 
-    *soc = ((float)(*totalVoltage) - (float)MIN_VOLTAGE) / ((float)MAX_VOLTAGE - (float)MIN_VOLTAGE);
-    
-    *highestTemp = getTemps(temps, NUM_TEMPS);
-    for(int i = 0; i < NUM_TEMPS; i++){
-        if(temps[i] < 5 || temps[i] > 40){
-            //Two Possibilities:
-            //Open circuit temp sensor -- do not allow battery to charge or discharge
-            //Batteries are too hot -- possible short circuit
-            return 0;
-        }
-    }
-    
-    *current = getCurrent();
-    if(*current < -2 || *current > 2){
-       //Current Sensor Issue
-        return 0;
-    }
-    
-    return 1;
-}
-
-char running(){
- return 1;   
-}
-
-/******************************************************************************/
-//ISR()
-//All interrupts go through this function
-//All interrupts have the same priority
-/******************************************************************************/
-void __interrupt ISR(void){
-    //TIMER0 
-    if(INTCONbits.TMR0IF == 1 && INTCONbits.TMR0IE == 1){
-        k ++;
-        if(k >= 3){ //0.1mS
-            currentBool = 1;
-            k=0;
-            j++;
-        }
-        
-        if(j>=10000){//1s
-            uartBool = 1;
-            j = 0;
-        }
-        INTCONbits.TMR0IF = 0; //Interrupt Disable
-    }
-    //Timer2
-    if(PIE1bits.TMR2IE == 1 && PIR1bits.TMR2IF == 1){
-        currentBool = 1; //Set bool so that current can be measured
-        PIR1bits.TMR2IF = 0; //Interrupt Disable
-    }
-    //UART
-    if(PIR1bits.TXIF == 1 && PIE1bits.TXIE == 1){
-        if(str[z] != '\0'){
-            TXREG = str[z];
-            z++;
-        }else{
-            z = 0;
-            uartDisable(); //UART TX INTERRUPT EN
-        }
-    }
-    //SPI
-    if(PIR1bits.SSP1IF == 1 && PIE1bits.SSP1IE == 1){ //not using the interrupt
-        PIR1bits.SSP1IF = 0;
-    }
-     
-}
-  
-/******************************************************************************/
-//void setup()
-//Calls the setup functions for the modules that are used
-/******************************************************************************/
-void setup(void){
-    //Misc
-        TRISDbits.TRISD4 = 0; //Enable Charge Pin
-        TRISDbits.TRISD5 = 0; //Enable Discharge Pin
-        TRISAbits.TRISA0 = 1; //Charge Enable Switch -- 5V = Charge, 0V = Discharge
-        
-    //General Setup
-        INTCONbits.GIE = 1; //GLOBAL INTERRUPT EN
-        INTCONbits.PEIE = 1; //PERIPERIAL INTERRUPT EN
-      
-    //Timer
-        timerSetup();
-   
-    //LED
-        TRISAbits.TRISA5 = 0; //Test LED
-        LATAbits.LATA5 = 1; //Turn on LED
-        
-    //GPIO
-        TRISAbits.TRISA4 = 0;
-     
-    //ADCs
-        adcSetup();
-    
-    //UART
-        uartSetup();
-        
-    //I2C
-        TRISBbits.TRISB6 = 1; //i2c requires these be inputs
-        TRISBbits.TRISB7 = 1; //i2c requires these be inputs
-        i2cSetup();
-   
-    //SPI: PIC is Master -> LTC6804-2 is Slave
-       TRISCbits.TRISC5 = 0; //Data Out Line
-       TRISCbits.TRISC4 = 1; //Data In Line
-       TRISCbits.TRISC3 = 0; //Driving Clock Line
-       TRISDbits.TRISD3 = 0; //CS Pin -- Active when pulled to ground
-       spiSetup();
-
-    //LTC
-       LTC6804_initialize();
+/*
+ *  File:   main.c
+ *  Author: Tyler Matthews
+ */
+
+//Includes
+    #include <xc.h>
+    #include "timer.h"
+    #include "ltc6804.h"
+    #include "adc.h"
+    #include "uart.h"
+    #include "i2c.h"
+    #include "spi.h"
+    #include "SSD1306.h"
+    #include "coulomb.h"
+    #include "ocv.h"
+    #include "ekf.h"
+    #include "ir.h"
+    #include "sop.h"
+    #include "soh.h"
+    #include "rainflow.h"
+    #include "fault.h"
+    #include "sensor.h"
+    #include "slope.h"
+    #include "watchdog.h"
+    #include "trace.h"
+    #include "telemetry.h"
+    #include "console.h"
+    #include "command.h"
+    #include "capture.h"
+    #include "config.h"
+
+//Defines
+    #define FOSC 32000000
+    #define FCY 32000000/2
+    #define NUM_TEMPS 5
+    #define NUM_CURRENT 20
+    #define NUM_VOLTAGES 12
+    #define CAPACITY 12 //Ahr, rated -- the SOH module tracks what is left
+    #define DISCHARGE_EN LATDbits.LATD5 //Discharge Enable Pin
+    #define CHARGE_EN  LATDbits.LATD4 //Charge Enable Pin
+    #define CHARGE_SWITCH PORTAbits.RA0
+    #define UART_PERIOD 1000 //mS between the slow estimator updates
+    #define TEST_LED LATAbits.LATA5
+
+//Prototypes
+    void setup();
+    int startUp(int *highestTemp, int temps[], float voltages[], float *totalVoltage, long *current, float *soc);
+    char running();
+    int clampCurrent(long current);
+    
+//Global Variables
+    int currentBool = 0; //Measuring Current bool
+
+//Main
+void main(void){    
+    int balanceEn[NUM_VOLTAGES] = {0}; //Keep track of cells that are being balanced
+    
+    float voltages[NUM_VOLTAGES]; //Voltages
+    float totalVoltage; //Total Voltage
+    
+    int currentIndex = 0; //Index for current buffer
+    long currentBuff[NUM_CURRENT]; //Buffer to store current values
+    long current = 0; //Current in mA
+    long sweepCurrent = 0; //Current sampled during the cell sweep (mA)
+    int irCell = 0; //Cell with the highest internal resistance
+    long sopLimits[4] = {0}; //Discharge 2S, discharge 10S, charge 2S, charge 10S (mA)
+    unsigned int packVoltage = 0; //Pack voltage in mV for energy counting
+    unsigned int dodCycles[RF_DOD_BINS] = {0}; //Full cycles per depth of discharge bin
+    
+    int temps[NUM_TEMPS] = {20, 20, 20, 20, 20}; //Temperatures
+    int highestTemp; //Highest Temperature
+
+    int lowestTemp = 20; //Lowest Temperature
+    unsigned char faultAction = 0; //Actions of the active faults
+    float soc = 0; //SOC Percentage out of 100
+    unsigned long lastSample = 0; //Time of the last current sample (mS)
+    unsigned long lastUart = 0; //Time of the last UART write (mS)
+    unsigned long lastSlope = 0; //Time of the last trend sample (mS)
+    unsigned long lastConsole = 0; //Time of the last console refresh (mS)
+    unsigned int irWorst = 0; //Highest internal resistance (uOhm)
+    unsigned char requests = 0; //CMD_x requests from the last command
+    unsigned int isrLoad = 0; //Share of CPU spent in the ISR (0.1%)
+    long lastCharge = 0; //Coulomb counter charge at the last EKF update (mA-s)
+    unsigned int ekfStart = 0; //Timer1 at the start of the EKF update
+    unsigned int ekfCycles = 0; //Worst EKF update seen (instruction cycles)
+    
+    resetRecord(); //Before anything can clear the WDT flags
+    setup();
+    traceInit(); //Dumps the ring if a trip froze it before the reset
+    
+    __delay_ms(1000); //start delay
+    
+    DISCHARGE_EN = 0; //Defaults to charge and discharge circuits being off (current sensor is zeroed with them open)
+    //CHARGE_EN = startUp(&highestTemp, temps, voltages, &totalVoltage, &current, &soc); 
+    DISCHARGE_EN = startUp(&highestTemp, temps, voltages, &totalVoltage, &current, &soc);
+    faultInit();
+    sohInit((long)CAPACITY*3600000); //mA-s
+    coulombInit(sohCapacity(), (int)(soc*SOC_FULL));
+    ekfInit(sohCapacity(), (int)(soc*SOC_FULL));
+    rainflowInit((int)(soc*SOC_FULL));
+    lastCharge = coulombCharge();
+    lastSample = getMillis();
+    lastSlope = lastSample;
+    DISCHARGE_EN = 1;
+    watchdogStart(getMillis()); //Startup is done, every task is supervised from here on
+    /* Design for charging circuit went belly up -- might bodge it in
+    if(CHARGE_SWITCH == 1 ){
+        CHARGE_EN = startUp(highestTemp);   //If startup check is okay, enable charging
+    }else{
+        DISCHARGE_EN = startUp(highestTemp);               //If startup check is okay, enable discharging
+    }
+    */
+
+    
+    while(1){
+        
+       // while(running());
+       // while(!(running()));
+        TEST_LED ^= 1;
+        
+        /*MEASUREMENTS*/
+        //VOLTAGE
+        LTC6804_adcv(); //Start the cell sweep
+        sweepCurrent = getCurrent(); //Sampled while the cells convert so both line up in time
+        readVoltages(voltages, &totalVoltage, NUM_VOLTAGES); // Voltages 
+        irUpdate(cellCodes, sweepCurrent, getMillis());
+        sopCells(cellMin, cellMax);
+        packVoltage = (unsigned int)(totalVoltage*1000.0);
+        //TEMPERATURE
+        if(!captureBusy()){ //A capture holds the ADC on the current sensor, the last readings stand
+            highestTemp = getTemps(temps, NUM_TEMPS, &lowestTemp); // Temperatures, failed sensors are left out
+        }
+        taskCheckIn(TASK_MEASURE, getMillis());
+        //TRENDS
+        if(getMillis() - lastSlope >= SLOPE_PERIOD){
+            slopeUpdate(temps, cellCodes, sweepCurrent);
+            lastSlope += SLOPE_PERIOD; //Fixed spacing, the fit assumes it
+        }
+        //CURRENT
+         if(currentBool == 1){ //Add current to buffer
+            unsigned long now = getMillis();
+            currentBuff[currentIndex] = getCurrent();
+            coulombUpdate(currentBuff[currentIndex], now - lastSample); //Every sample is counted against its own dt
+            sohUpdate(currentBuff[currentIndex], packVoltage, now - lastSample);
+            lastSample = now;
+            restUpdate(currentBuff[currentIndex], now);
+            sopUpdate(currentBuff[currentIndex], lowestTemp, highestTemp, coulombSoc(), irMax(&irCell)); //Limits follow every sample
+            
+            currentIndex ++;
+            if(currentIndex >= NUM_CURRENT){ //Average buffer to get finalized current value
+                current = avgBuff(currentBuff, currentIndex);
+                currentIndex = 0;
+            }
+            currentBool = 0;
+            taskCheckIn(TASK_CURRENT, now);
+        }
+        /*END MEASUREMENTS*/
+        
+        /*FAULT CHECKING*/
+        //TEMPERATURE 
+        faultInput(FAULT_SRC_TEMP_MAX, highestTemp);
+        faultInput(FAULT_SRC_TEMP_MIN, lowestTemp);
+        faultInput(FAULT_SRC_TEMP_SENSORS, sensorFailedTemps());
+        faultInput(FAULT_SRC_CURRENT_SENSOR, (sensorFailed() & (1 << SENSOR_CURRENT)) ? 1 : 0);
+        //CURRENT -- the sweep sample is fresh every pass, the debounce does the filtering
+        faultInput(FAULT_SRC_DISCHARGE, clampCurrent(sweepCurrent));
+        faultInput(FAULT_SRC_CHARGE, clampCurrent(-sweepCurrent));
+        //VOLTAGES
+        faultInput(FAULT_SRC_CELL_MAX, cellMax/10); //mV
+        faultInput(FAULT_SRC_CELL_MIN, cellMin/10);
+        //TRENDS
+        faultInput(FAULT_SRC_RUNAWAY, slopeRunaway(sensorFailed()));
+        //APPLY ACTIONS
+        faultAction = faultTick();
+        DISCHARGE_EN = (faultAction & FAULT_OPEN_DISCHARGE) ? 0 : 1;
+        if(faultAction & FAULT_OPEN_CHARGE){
+            CHARGE_EN = 0;
+        }
+        sopDerate(faultAction & FAULT_DERATE);
+        taskCheckIn(TASK_FAULT, getMillis());
+        //BLACK BOX
+        traceRecord(getMillis(), cellMin, cellMax, sweepCurrent, highestTemp, faultActive(), watchdogLate());
+        if(faultAction & (FAULT_OPEN_DISCHARGE | FAULT_OPEN_CHARGE)){
+            traceFreeze(); //Keep what led up to the trip
+        }
+        /*END FAULT CHECKING*/
+        
+       /*WRITE DATA TO DISP*/
+        //UART
+        if(getMillis() - lastUart >= UART_PERIOD){ //UART
+            unsigned long now = getMillis();
+            cellBalancing(cellCodes, NUM_VOLTAGES, balanceEn); //Balance the cells
+            
+            ekfStart = readTimer1();
+            ekfUpdate(coulombCharge() - lastCharge, current, (unsigned int)(totalVoltage*10000.0/NUM_VOLTAGES), now - lastUart);
+            ekfStart = readTimer1() - ekfStart;
+            if(ekfStart > ekfCycles){
+                ekfCycles = ekfStart;
+            }
+            
+            if(ocvCorrect((unsigned int)(totalVoltage*1000.0/NUM_VOLTAGES), now)){ //Only moves SOC after a rest period
+                if(sohAnchor(ocvToSoc((unsigned int)(totalVoltage*1000.0/NUM_VOLTAGES)))){ //New capacity measurement
+                    coulombInit(sohCapacity(), coulombSoc());
+                    ekfInit(sohCapacity(), ekfSoc());
+                }
+            }
+            sohSave(now);
+            rainflowUpdate(coulombSoc());
+            rainflowSave(now);
+            lastCharge = coulombCharge();
+            lastUart = now;
+            isrLoad = getIsrLoad();
+            sopLimits[0] = sopDischarge(SOP_2S);
+            sopLimits[1] = sopDischarge(SOP_10S);
+            sopLimits[2] = sopCharge(SOP_2S);
+            sopLimits[3] = sopCharge(SOP_10S);
+            for(int i = 0; i < RF_DOD_BINS; i++){
+                dodCycles[i] = rainflowCycles(i);
+            }
+            irWorst = irMax(&irCell);
+            taskCheckIn(TASK_UART, getMillis());
+        }
+        //CONSOLE -- only the fields that changed go out
+        if(telemetryMode() == TLM_ASCII && getMillis() - lastConsole >= CONSOLE_PERIOD){
+            lastConsole = getMillis();
+            consoleRefresh(cellCodes, balanceEn, temps, highestTemp, current, coulombSoc(), ekfSoc(), ekfCycles, isrLoad, irWorst, irCell, sopLimits, sohHealth(), sohCycles(), sohThroughput(), sohEnergy(), dodCycles, faultActive(), faultLatched(), faultAction, sensorFailed(), slopeTempMax(sensorFailed()), slopeCellMin(), resetReason(), watchdogLate(), spiTimeouts + adcTimeouts + uartTimeouts, uartOverflows);
+        }
+        //TELEMETRY -- each subscribed channel at its own rate
+        captureService(getMillis()); //Ahead of the channels so a finished capture gets the ring first
+        if(telemetryMode() == TLM_BINARY){
+            telemetryService(getMillis(), cellCodes, cellMin, cellMax, sweepCurrent, temps, coulombSoc(), ekfSoc(), faultActive(), faultAction, sensorFailed());
+            if(requests & CMD_SNAPSHOT){
+                telemetryStatus(cellCodes, sweepCurrent, temps, coulombSoc(), ekfSoc(), faultActive(), faultAction, sensorFailed());
+            }
+        }
+        //I2C
+        /**********/
+        /*END WRITING DATA TO DISPLAY*/
+        
+        //COMMANDS -- last, so nothing they do can hold up a sample
+        requests = commandService(current, !DISCHARGE_EN && !CHARGE_EN);
+        
+        watchdogService(getMillis()); //WDT is only cleared while every task is on time
+    }
+}
+
+/******************************************************************************/
+//int startup()
+//Run once on start up. Ensures that batteries are in a safe
+//operating condition prior to initial startup. Then calculates initial soc
+//to give column counting algorithm an accurate start point. Contactors must
+//be open so the current sensor can be zeroed
+/******************************************************************************/
+int startUp(int *highestTemp, int temps[], float voltages[], float *totalVoltage, long *current, float *soc){
+    measureVoltages(voltages, totalVoltage, NUM_VOLTAGES);
+    for(int i = 0; i < NUM_VOLTAGES; i++){
+        if(voltages[i] > 4.2 || voltages[i] < 3.1){
+            //Batteries are over or under charged
+            return 0;
+        }
+    }
+    *totalVoltage = sumVoltages(voltages, NUM_VOLTAGES); 
+    *soc = (float)ocvToSoc((unsigned int)(*totalVoltage*1000.0/NUM_VOLTAGES))/SOC_FULL; //Contactors are open so this is a rested voltage
+    
+    int lowestTemp;
+    for(int i = 0; i < SENSOR_FAIL_COUNT; i++){ //Enough readings for the health checks to settle
+        *highestTemp = getTemps(temps, NUM_TEMPS, &lowestTemp);
+    }
+    if(sensorFailedTemps() >= SENSOR_TEMPS_LOST){
+        //Open or shorted temp sensors -- too few left to see the pack
+        return 0;
+    }
+    if(lowestTemp < 5 || *highestTemp > 40){
+        //Bad sensors are already left out, so the pack really is too cold or too hot
+        return 0;
+    }
+    
+    if(!calibrateCurrent()){ //Zero the current sensor
+       //Current Sensor Issue
+        return 0;
+    }
+    *current = getCurrent();
+    
+    return 1;
+}
+
+char running(){
+ return 1;   
+}
+
+//Fits a current (mA) into an int for the fault table
+int clampCurrent(long current){
+    if(current > 32000){
+        return 32000;
+    }else if(current < -32000){
+        return -32000;
+    }
+    return (int)current;
+}
+
+/******************************************************************************/
+//ISR()
+//All interrupts go through this function
+//All interrupts have the same priority, so sources are checked in order of
+//how often they fire and each path is kept as short as possible
+/******************************************************************************/
+void __interrupt ISR(void){
+    ISR_PROFILE_START();
+    
+    //TIMER2 -- burst current capture, first so the samples stay evenly spaced
+    if(PIR1bits.TMR2IF == 1 && PIE1bits.TMR2IE == 1){
+        CAPTURE_TICK();
+    }
+    //UART RX -- the hardware only holds two bytes
+    if(PIR1bits.RCIF == 1 && PIE1bits.RCIE == 1){
+        UART_RX_TICK();
+    }
+    //UART TX -- every byte (~60uS at 166kBaud) while the TX ring has data
+    if(PIR1bits.TXIF == 1 && PIE1bits.TXIE == 1){
+        UART_TX_TICK();
+    }
+    //TIMER0 -- System Clock, every 1.024mS
+    if(INTCONbits.TMR0IF == 1 && INTCONbits.TMR0IE == 1){
+        TIMER_TICK();
+        currentBool = 1;
+        INTCONbits.TMR0IF = 0; //Interrupt Disable
+    }
+    
+    ISR_PROFILE_END();
+}
+  
+/******************************************************************************/
+//void setup()
+//Calls the setup functions for the modules that are used
+/******************************************************************************/
+void setup(void){
+    //Misc
+        TRISDbits.TRISD4 = 0; //Enable Charge Pin
+        TRISDbits.TRISD5 = 0; //Enable Discharge Pin
+        TRISAbits.TRISA0 = 1; //Charge Enable Switch -- 5V = Charge, 0V = Discharge
+        
+    //General Setup
+        INTCONbits.GIE = 1; //GLOBAL INTERRUPT EN
+        INTCONbits.PEIE = 1; //PERIPERIAL INTERRUPT EN
+      
+    //Timer
+        timerSetup();
+   
+    //LED
+        TRISAbits.TRISA5 = 0; //Test LED
+        LATAbits.LATA5 = 1; //Turn on LED
+        
+    //GPIO
+        TRISAbits.TRISA4 = 0;
+     
+    //ADCs
+        adcSetup();
+    
+    //UART
+        uartSetup();
+        
+    //I2C
+        TRISBbits.TRISB6 = 1; //i2c requires these be inputs
+        TRISBbits.TRISB7 = 1; //i2c requires these be inputs
+        i2cSetup();
+   
+    //SPI: PIC is Master -> LTC6804-2 is Slave
+       TRISCbits.TRISC5 = 0; //Data Out Line
+       TRISCbits.TRISC4 = 1; //Data In Line
+       TRISCbits.TRISC3 = 0; //Driving Clock Line
+       TRISDbits.TRISD3 = 0; //CS Pin -- Active when pulled to ground
+       spiSetup();
+
+    //LTC
+       LTC6804_initialize();
 }
\ No newline at end of file
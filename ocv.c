@@ -0,0 +1,82 @@
+/*
+ * File:   ocv.c
+ * Author: trm84
+ *
+ * Created on October 19, 2026, 1:40 PM
+ */
+
+#include "ocv.h"
+#include "coulomb.h"
+
+//Resting cell voltage (mV) at 0%, 10%, ... 100% SOC
+#if OCV_CHEMISTRY == OCV_LFP
+const unsigned int ocvTable[OCV_POINTS] = {2800, 3150, 3220, 3260, 3280, 3290, 3300, 3310, 3330, 3340, 3600};
+#else
+const unsigned int ocvTable[OCV_POINTS] = {3200, 3450, 3550, 3610, 3660, 3710, 3780, 3860, 3950, 4060, 4200};
+#endif
+
+unsigned long restStart = 0; //Time the current last dropped below REST_CURRENT (mS)
+char resting = 0; //1 while the current is below REST_CURRENT
+
+//Returns the SOC (0.01%) for a rested cell voltage (mV) by interpolating the OCV table
+int ocvToSoc(unsigned int cellVoltage){
+    char i;
+    
+    if(cellVoltage <= ocvTable[0]){
+        return 0;
+    }
+    if(cellVoltage >= ocvTable[OCV_POINTS - 1]){
+        return SOC_FULL;
+    }
+    for(i = 0; i < OCV_POINTS - 2; i++){ //Find the segment the voltage falls in
+        if(cellVoltage < ocvTable[i + 1]){
+            break;
+        }
+    }
+    return (i * OCV_STEP) + (int)(((long)(cellVoltage - ocvTable[i]) * OCV_STEP) / (ocvTable[i + 1] - ocvTable[i]));
+}
+
+//Returns the rested cell voltage (mV) for a SOC (0.01%). The table step (mV
+//per 10% SOC) of the segment is written to slope for the EKF
+unsigned int socToOcv(int soc, unsigned int *slope){
+    char i;
+    
+    if(soc < 0){
+        soc = 0;
+    }else if(soc >= SOC_FULL){
+        soc = SOC_FULL - 1;
+    }
+    i = (char)(soc / OCV_STEP);
+    *slope = ocvTable[i + 1] - ocvTable[i];
+    return ocvTable[i] + (unsigned int)(((long)(soc - (i * OCV_STEP)) * *slope) / OCV_STEP);
+}
+
+//Tracks how long the pack has been resting, called with every current sample (mA)
+void restUpdate(long current, unsigned long now){
+    if(current < REST_CURRENT && current > -REST_CURRENT){
+        if(!resting){
+            resting = 1;
+            restStart = now;
+        }
+    }else{
+        resting = 0;
+    }
+}
+
+//Returns 1 once the pack has been resting for REST_TIME
+char isRested(unsigned long now){
+    return resting && (now - restStart >= REST_TIME);
+}
+
+//Pulls the coulomb counter toward the OCV SOC while rested. The average cell
+//voltage (mV) is used so one odd cell doesn't move the pack SOC.
+//Returns 1 if a correction was made
+char ocvCorrect(unsigned int cellVoltage, unsigned long now){
+    if(!isRested(now)){
+        return 0;
+    }
+    int socCc = coulombSoc();
+    int socOcv = ocvToSoc(cellVoltage);
+    coulombSetSoc(socCc + ((socOcv - socCc) / (1 << OCV_BLEND_SHIFT)));
+    return 1;
+}
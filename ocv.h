@@ -0,0 +1,55 @@
+/* Microchip Technology Inc. and its subsidiaries.  You may use this software
+ * and any derivatives exclusively with Microchip products.
+ *
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+ * TERMS.
+ */
+
+/*
+ * File: ocv
+ * Author: Tyler Matthews
+ * Comments: Open circuit voltage to SOC lookup and rest period recalibration.
+ *           Once the pack has rested long enough for the cell voltage to
+ *           settle, the coulomb counted SOC is pulled toward the OCV estimate.
+ *           Everything is integer math with a fixed worst case: one pass over
+ *           the 11 entry table, one multiply and one divide per call.
+ * Revision history:
+ */
+
+#ifndef OCV_H
+#define OCV_H
+
+//Defines
+    #define OCV_NMC 0
+    #define OCV_LFP 1
+    #define OCV_CHEMISTRY OCV_NMC //Selects the OCV table
+
+    #define OCV_POINTS 11 //0%, 10%, ... 100%
+    #define OCV_STEP 1000 //SOC (0.01%) between table points
+
+    #define REST_CURRENT 200 //mA, below this the pack is resting
+    #define REST_TIME 600000 //mS (10 minutes) of rest before OCV is trusted
+    #define OCV_BLEND_SHIFT 4 //Each correction moves 1/16 of the way to the OCV SOC
+
+//Prototypes
+    int ocvToSoc(unsigned int cellVoltage);
+    unsigned int socToOcv(int soc, unsigned int *slope);
+    void restUpdate(long current, unsigned long now);
+    char isRested(unsigned long now);
+    char ocvCorrect(unsigned int cellVoltage, unsigned long now);
+
+#endif
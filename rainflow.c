@@ -0,0 +1,137 @@
+/*
+ * File:   rainflow.c
+ * Author: trm84
+ *
+ * Created on October 19, 2026, 5:10 PM
+ */
+
+#include "rainflow.h"
+#include "coulomb.h"
+#include "eeprom.h"
+
+int rfStack[RF_STACK]; //Turning points not yet closed into a cycle (0.01% SOC)
+int rfPoints = 0;
+int rfExtreme = 0; //Furthest point since the last turn
+signed char rfDir = 0; //1 rising, -1 falling, 0 not moved yet
+unsigned int rfHist[RF_DOD_BINS][RF_MEAN_BINS]; //Half cycles
+char rfChanged = 0; //Histogram moved since the last save
+unsigned long rfLastSave = 0; //mS
+
+//Adds half cycles for the range between two turning points
+void rfCount(int a, int b, unsigned int halves){
+    int range = a > b ? a - b : b - a;
+    int dod = range / RF_DOD_STEP;
+    int mean = (a / 2 + b / 2) / RF_MEAN_STEP;
+    if(dod >= RF_DOD_BINS){
+        dod = RF_DOD_BINS - 1;
+    }
+    if(mean >= RF_MEAN_BINS){
+        mean = RF_MEAN_BINS - 1;
+    }
+    if(rfHist[dod][mean] <= 0xFFFF - halves){ //Saturate rather than wrap
+        rfHist[dod][mean] += halves;
+    }
+    rfChanged = 1;
+}
+
+//Pushes a turning point and closes every cycle it completes
+void rfPush(int point){
+    rfStack[rfPoints] = point;
+    rfPoints++;
+
+    while(rfPoints >= 4){ //Four point rule: the inner range is a cycle if both outer ranges contain it
+        int x = rfStack[rfPoints - 1] - rfStack[rfPoints - 2];
+        int y = rfStack[rfPoints - 2] - rfStack[rfPoints - 3];
+        int z = rfStack[rfPoints - 3] - rfStack[rfPoints - 4];
+        x = x < 0 ? -x : x;
+        y = y < 0 ? -y : y;
+        z = z < 0 ? -z : z;
+        if(y > x || y > z){
+            break;
+        }
+        rfCount(rfStack[rfPoints - 2], rfStack[rfPoints - 3], 2);
+        rfStack[rfPoints - 3] = rfStack[rfPoints - 1];
+        rfPoints -= 2;
+    }
+
+    if(rfPoints == RF_STACK){ //Residue is full, retire the oldest range as a half cycle
+        rfCount(rfStack[0], rfStack[1], 1);
+        for(int i = 1; i < RF_STACK; i++){
+            rfStack[i - 1] = rfStack[i];
+        }
+        rfPoints--;
+    }
+}
+
+//Loads the saved histogram and starts the signal at soc (0.01%)
+void rainflowInit(int soc){
+    if(eepromRead(EE_RF_VALID) == EE_RF_MAGIC){
+        for(int i = 0; i < RF_DOD_BINS; i++){
+            for(int j = 0; j < RF_MEAN_BINS; j++){
+                rfHist[i][j] = eepromReadWord(EE_RF_HIST + 2*(i*RF_MEAN_BINS + j));
+            }
+        }
+    }
+    rfPoints = 0;
+    rfPush(soc); //The start counts as a turning point
+    rfExtreme = soc;
+    rfDir = 0;
+}
+
+//Feed with the SOC (0.01%), any rate that follows the charge and discharge swings
+void rainflowUpdate(int soc){
+    if(rfDir == 0){ //Waiting for the first real move
+        if(soc >= rfExtreme + RF_HYST){
+            rfDir = 1;
+            rfExtreme = soc;
+        }else if(soc <= rfExtreme - RF_HYST){
+            rfDir = -1;
+            rfExtreme = soc;
+        }
+    }else if(rfDir > 0){
+        if(soc > rfExtreme){
+            rfExtreme = soc;
+        }else if(soc <= rfExtreme - RF_HYST){ //Turned over, the peak was a turning point
+            rfPush(rfExtreme);
+            rfDir = -1;
+            rfExtreme = soc;
+        }
+    }else{
+        if(soc < rfExtreme){
+            rfExtreme = soc;
+        }else if(soc >= rfExtreme + RF_HYST){
+            rfPush(rfExtreme);
+            rfDir = 1;
+            rfExtreme = soc;
+        }
+    }
+}
+
+//Saves the histogram when it has moved, at most every RF_SAVE_PERIOD
+void rainflowSave(unsigned long now){
+    if(!rfChanged || now - rfLastSave < RF_SAVE_PERIOD){
+        return;
+    }
+    for(int i = 0; i < RF_DOD_BINS; i++){
+        for(int j = 0; j < RF_MEAN_BINS; j++){
+            eepromWriteWord(EE_RF_HIST + 2*(i*RF_MEAN_BINS + j), rfHist[i][j]); //Only changed bytes are written
+        }
+    }
+    eepromWrite(EE_RF_VALID, EE_RF_MAGIC);
+    rfChanged = 0;
+    rfLastSave = now;
+}
+
+//Returns half cycles in one bin
+unsigned int rainflowCount(int dodBin, int meanBin){
+    return rfHist[dodBin][meanBin];
+}
+
+//Returns full cycles at one depth of discharge, all mean SOCs
+unsigned int rainflowCycles(int dodBin){
+    unsigned long halves = 0;
+    for(int j = 0; j < RF_MEAN_BINS; j++){
+        halves += rfHist[dodBin][j];
+    }
+    return (unsigned int)(halves / 2);
+}
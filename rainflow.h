@@ -0,0 +1,56 @@
+/* Microchip Technology Inc. and its subsidiaries.  You may use this software
+ * and any derivatives exclusively with Microchip products.
+ *
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+ * TERMS.
+ */
+
+/*
+ * File: rainflow
+ * Author: Tyler Matthews
+ * Comments: Streaming rainflow cycle counter on the SOC signal. Turning
+ *           points (reversals bigger than RF_HYST) go on a small stack and
+ *           closed cycles are pulled off with the four point rule, so only
+ *           the unclosed residue is ever kept. Cycles are binned by depth of
+ *           discharge and mean SOC in half cycles. If the residue fills the
+ *           stack its oldest range is counted as a half cycle.
+ *           RAM: 2*RF_STACK + 2*RF_DOD_BINS*RF_MEAN_BINS bytes.
+ *           The histogram is saved to EEPROM at most every RF_SAVE_PERIOD,
+ *           the residue is not kept across a reset.
+ * Revision history:
+ */
+
+#ifndef RAINFLOW_H
+#define RAINFLOW_H
+
+//Defines
+    #define RF_STACK 16 //Turning points held, random sessions need up to 13 (tools/rainflow_check.cpp)
+    #define RF_HYST 100 //0.01% SOC, smaller reversals are noise
+    #define RF_DOD_BINS 5 //0-20%, 20-40%, ... 80-100% depth of discharge
+    #define RF_DOD_STEP 2000
+    #define RF_MEAN_BINS 4 //0-25%, 25-50%, 50-75%, 75-100% mean SOC
+    #define RF_MEAN_STEP 2500
+    #define RF_SAVE_PERIOD 3600000 //mS (1 hour) between EEPROM saves
+
+//Prototypes
+    void rainflowInit(int soc);
+    void rainflowUpdate(int soc);
+    void rainflowSave(unsigned long now);
+    unsigned int rainflowCount(int dodBin, int meanBin);
+    unsigned int rainflowCycles(int dodBin);
+
+#endif
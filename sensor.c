@@ -0,0 +1,97 @@
+/*
+ * File:   sensor.c
+ * Author: trm84
+ *
+ * Created on October 19, 2026, 6:45 PM
+ */
+
+#include "sensor.h"
+
+typedef struct{
+    int low; //ADC code at or below is low status
+    int high; //ADC code at or above is high status
+    char lowStatus;
+    char highStatus;
+    int rate; //Largest change per reading in ADC codes, 0 for none
+}sensorLimits;
+
+//The current sensor has no rate limit: a short circuit is a real step and must never be held off
+const sensorLimits sensorTable[SENSOR_CHANNELS] = {
+    {41, 4014, SENSOR_SHORT, SENSOR_OPEN, SENSOR_TEMP_RATE}, //TEMP1, 0.05V and 4.9V
+    {41, 4014, SENSOR_SHORT, SENSOR_OPEN, SENSOR_TEMP_RATE}, //TEMP2
+    {41, 4014, SENSOR_SHORT, SENSOR_OPEN, SENSOR_TEMP_RATE}, //TEMP3
+    {41, 4014, SENSOR_SHORT, SENSOR_OPEN, SENSOR_TEMP_RATE}, //TEMP4
+    {41, 4014, SENSOR_SHORT, SENSOR_OPEN, SENSOR_TEMP_RATE}, //TEMP5
+    {205, 3890, SENSOR_RAIL, SENSOR_RAIL, 0}, //Current, output lives inside 0.25V-4.75V
+};
+
+int sensorLast[SENSOR_CHANNELS]; //Last good value
+int sensorLastCode[SENSOR_CHANNELS]; //ADC code of the last good value
+char sensorSeeded[SENSOR_CHANNELS]; //Has a good value to compare against
+char sensorState[SENSOR_CHANNELS]; //Status of the last reading
+unsigned char sensorBad[SENSOR_CHANNELS]; //Bad readings in a row
+unsigned char sensorGood[SENSOR_CHANNELS]; //Good readings in a row while failed
+unsigned char sensorFail = 0; //Failed channels, one bit each
+
+//Checks one reading (raw code and converted value). Returns the value to use,
+//which is the last good value while the reading is bad
+int sensorUpdate(char ch, int code, int value){
+    char status = SENSOR_OK;
+    unsigned char bit = 1 << ch;
+
+    if(code <= sensorTable[ch].low){
+        status = sensorTable[ch].lowStatus;
+    }else if(code >= sensorTable[ch].high){
+        status = sensorTable[ch].highStatus;
+    }else if(sensorSeeded[ch] && sensorTable[ch].rate != 0){
+        int delta = code - sensorLastCode[ch];
+        if(delta > sensorTable[ch].rate || delta < -sensorTable[ch].rate){
+            status = SENSOR_RATE;
+        }
+    }
+    sensorState[ch] = status;
+
+    if(status == SENSOR_OK){
+        sensorLast[ch] = value;
+        sensorLastCode[ch] = code;
+        sensorSeeded[ch] = 1;
+        sensorBad[ch] = 0;
+        if((sensorFail & bit) && ++sensorGood[ch] >= SENSOR_PASS_COUNT){
+            sensorFail &= ~bit;
+        }
+        return value;
+    }
+
+    sensorGood[ch] = 0;
+    if(sensorBad[ch] < SENSOR_FAIL_COUNT && ++sensorBad[ch] >= SENSOR_FAIL_COUNT){
+        sensorFail |= bit;
+        sensorSeeded[ch] = 0; //Held value is stale, the next good reading starts over
+    }
+    return sensorSeeded[ch] ? sensorLast[ch] : value;
+}
+
+//Returns 1 if the channel can be used for max/min
+char sensorOk(char ch){
+    return sensorSeeded[ch] && !(sensorFail & (1 << ch));
+}
+
+//Returns the status of the channel's last reading
+char sensorStatus(char ch){
+    return sensorState[ch];
+}
+
+//Returns the failed channels, one bit each
+unsigned char sensorFailed(){
+    return sensorFail;
+}
+
+//Returns the number of failed thermistors
+int sensorFailedTemps(){
+    int count = 0;
+    for(int i = 0; i < SENSOR_TEMPS; i++){
+        if(sensorFail & (1 << i)){
+            count++;
+        }
+    }
+    return count;
+}
@@ -0,0 +1,65 @@
+/* Microchip Technology Inc. and its subsidiaries.  You may use this software
+ * and any derivatives exclusively with Microchip products.
+ *
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+ * TERMS.
+ */
+
+/*
+ * File: sensor
+ * Author: Tyler Matthews
+ * Comments: Plausibility checks for the thermistors and the current sensor.
+ *           Every reading is checked against its channel's open/short/rail
+ *           limits and a rate of change limit, both on the raw ADC codes:
+ *           the thermistor LUT steps 4-30C at its ends, so a single genuine
+ *           step there would read as an impossible temperature jump. A channel
+ *           fails after SENSOR_FAIL_COUNT bad readings in a row and comes
+ *           back after SENSOR_PASS_COUNT good ones. Until then the last good
+ *           value is held. Failed channels are left out of max/min so one
+ *           bad thermistor degrades the pack instead of tripping it.
+ * Revision history:
+ */
+
+#ifndef SENSOR_H
+#define SENSOR_H
+
+//Defines -- Channels
+    #define SENSOR_TEMPS 5 //Channels 0-4 are TEMP1-TEMP5
+    #define SENSOR_CURRENT 5
+    #define SENSOR_CHANNELS 6
+
+//Defines -- Status
+    #define SENSOR_OK 0
+    #define SENSOR_OPEN 1 //Thermistor open, input pulled to 5V (-273C in the LUT)
+    #define SENSOR_SHORT 2 //Thermistor shorted, input at 0V (148C in the LUT)
+    #define SENSOR_RAIL 3 //Current sensor output stuck at a rail
+    #define SENSOR_RATE 4 //Changed faster than the channel physically can
+
+    #define SENSOR_FAIL_COUNT 10 //Bad readings in a row before a channel fails
+    #define SENSOR_PASS_COUNT 50 //Good readings in a row before it comes back
+    #define SENSOR_TEMPS_LOST 3 //Failed thermistors that leave too little of the pack covered
+    #define SENSOR_TEMP_RATE 164 //ADC codes (0.2V, two LUT steps) per reading, the pack can't heat that fast between passes
+    #define SENSOR_TEMP_NONE 25 //Reported when no thermistor is left, the sensor fault has the pack open by then
+
+//Prototypes
+    int sensorUpdate(char ch, int code, int value);
+    char sensorOk(char ch);
+    char sensorStatus(char ch);
+    unsigned char sensorFailed();
+    int sensorFailedTemps();
+
+#endif
@@ -0,0 +1,99 @@
+/*
+ * File:   slope.c
+ * Author: trm84
+ *
+ * Created on October 19, 2026, 7:30 PM
+ */
+
+#include "slope.h"
+#include "ir.h"
+
+signed char slopeDiffs[SLOPE_CHANNELS][SLOPE_WINDOW - 1]; //d_1 is at slopeHead
+int slopeA[SLOPE_CHANNELS];
+int slopeB[SLOPE_CHANNELS];
+int slopeC[SLOPE_CHANNELS];
+int slopeLast[SLOPE_CHANNELS]; //Previous sample, C or mV
+int slopeHead = 0; //Oldest difference
+int slopeSamples = 0; //Counts up to a full window
+
+//Slides one channel's window by one sample
+void slopePush(int ch, int value){
+    int d = value - slopeLast[ch];
+    slopeLast[ch] = value;
+    if(d > 127){ //Faster than any trend we care about, the threshold is crossed either way
+        d = 127;
+    }else if(d < -127){
+        d = -127;
+    }
+
+    int oldest = slopeDiffs[ch][slopeHead];
+    int a = slopeA[ch] - oldest; //Sums over the kept differences, indices shift down by one
+    slopeC[ch] = slopeC[ch] - 2*slopeB[ch] + slopeA[ch] + (SLOPE_WINDOW - 1)*(SLOPE_WINDOW - 1)*d;
+    slopeB[ch] = slopeB[ch] - slopeA[ch] + (SLOPE_WINDOW - 1)*d;
+    slopeA[ch] = a + d;
+    slopeDiffs[ch][slopeHead] = (signed char)d;
+}
+
+//Call every SLOPE_PERIOD with the temperatures (C), cell codes (100uV) and the current (mA)
+void slopeUpdate(int temps[], unsigned int codes[], long current){
+    for(int i = 0; i < SLOPE_TEMPS; i++){
+        slopePush(i, temps[i]);
+    }
+    for(int i = 0; i < SLOPE_CELLS; i++){
+        long mv = codes[i] / 10 + (current / 10) * (long)irGet(i) / 100000; //Back out the IR drop, discharge is positive. 10mA steps keep it in a long up to 350A at IR_MAX
+        slopePush(SLOPE_TEMPS + i, (int)mv);
+    }
+
+    if(slopeSamples == 0){ //First sample only sets the starting point
+        for(int ch = 0; ch < SLOPE_CHANNELS; ch++){
+            slopeA[ch] = slopeB[ch] = slopeC[ch] = 0;
+            slopeDiffs[ch][slopeHead] = 0;
+        }
+    }
+    if(slopeSamples < SLOPE_WINDOW){
+        slopeSamples++;
+    }
+
+    slopeHead++;
+    if(slopeHead >= SLOPE_WINDOW - 1){
+        slopeHead = 0;
+    }
+}
+
+//Returns the slope of a channel per minute (C/min or mV/min), 0 until the window is full
+int slopeGet(int ch){
+    if(slopeSamples < SLOPE_WINDOW){
+        return 0;
+    }
+    long fit = (long)SLOPE_WINDOW*slopeB[ch] - slopeC[ch];
+    return (int)(fit * (60000 / SLOPE_PERIOD) / SLOPE_DENOM);
+}
+
+//Returns the fastest temperature rise, failed sensors (bits as in sensor.h) are skipped
+int slopeTempMax(unsigned char failed){
+    int max = 0;
+    for(int i = 0; i < SLOPE_TEMPS; i++){
+        int s = slopeGet(i);
+        if(!(failed & (1 << i)) && s > max){
+            max = s;
+        }
+    }
+    return max;
+}
+
+//Returns the fastest cell sag (most negative dV/dt)
+int slopeCellMin(){
+    int min = 0;
+    for(int i = 0; i < SLOPE_CELLS; i++){
+        int s = slopeGet(SLOPE_TEMPS + i);
+        if(s < min){
+            min = s;
+        }
+    }
+    return min;
+}
+
+//Returns 1 when a temperature rise and a cell sag are both past their thresholds
+char slopeRunaway(unsigned char failed){
+    return slopeTempMax(failed) >= SLOPE_TEMP_RISE && slopeCellMin() <= -SLOPE_CELL_SAG;
+}
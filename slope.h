@@ -0,0 +1,58 @@
+/* Microchip Technology Inc. and its subsidiaries.  You may use this software
+ * and any derivatives exclusively with Microchip products.
+ *
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+ * TERMS.
+ */
+
+/*
+ * File: slope
+ * Author: Tyler Matthews
+ * Comments: dT/dt and dV/dt trend estimators for thermal runaway early
+ *           warning. Each channel is a least squares line over the last
+ *           SLOPE_WINDOW samples taken every SLOPE_PERIOD. Only the sample
+ *           to sample differences are kept (signed char, clamped), and the
+ *           fit is held as three running sums that slide in O(1):
+ *             A = sum(d_j), B = sum(j*d_j), C = sum(j^2*d_j), j = 1..N-1
+ *             slope = (N*B - C) / (N*(N^2 - 1)/6) per sample
+ *           Cell voltages are IR compensated so load steps don't read as sag.
+ *           RAM: 15 bytes per channel.
+ * Revision history:
+ */
+
+#ifndef SLOPE_H
+#define SLOPE_H
+
+//Defines
+    #define SLOPE_TEMPS 5
+    #define SLOPE_CELLS 12
+    #define SLOPE_CHANNELS 17 //Temps first, then cells
+    #define SLOPE_WINDOW 8 //Samples, also keeps the sums inside an int
+    #define SLOPE_PERIOD 10000 //mS between samples, the thermistor LUT steps are 3-5C so the window has to be long (80S)
+    #define SLOPE_DENOM 84 //N*(N^2 - 1)/6 for N = 8
+
+    #define SLOPE_TEMP_RISE 5 //C/min, a steady rise this fast...
+    #define SLOPE_CELL_SAG 50 //mV/min, ...with a cell sagging this fast is an early runaway warning
+
+//Prototypes
+    void slopeUpdate(int temps[], unsigned int codes[], long current);
+    int slopeGet(int ch);
+    int slopeTempMax(unsigned char failed);
+    int slopeCellMin();
+    char slopeRunaway(unsigned char failed);
+
+#endif
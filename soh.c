@@ -0,0 +1,134 @@
+/*
+ * File:   soh.c
+ * Author: trm84
+ *
+ * Created on October 19, 2026, 4:20 PM
+ */
+
+#include "soh.h"
+#include "coulomb.h"
+#include "eeprom.h"
+
+long ratedCapacity = 1; //mA*s
+long sohCap = 1; //Effective capacity in mA*s
+long anchorCharge = 0; //Net charge out since the last anchor (mA*s), discharge is positive
+long anchorRemainder = 0; //Sub mA*s part in mA*mS
+int anchorSoc = 0; //OCV SOC at the last anchor (0.01%)
+char anchorValid = 0;
+char sohChanged = 0; //Capacity moved since the last save
+unsigned long lastSave = 0; //mS
+
+unsigned long throughput = 0; //Lifetime charge in and out (mAh)
+unsigned long discharged = 0; //Lifetime charge out (mAh)
+unsigned long energy = 0; //Lifetime energy in and out (mWh)
+unsigned long throughputRemainder = 0; //mA*mS, below one mAh
+unsigned long dischargeRemainder = 0; //mA*mS
+unsigned long energyRemainder = 0; //uWh (mAh * mV), below one mWh
+
+//Sets the rated capacity (mA*s) and loads the saved state
+void sohInit(long rated){
+    ratedCapacity = rated;
+    sohCap = rated;
+    if(eepromRead(EE_SOH_VALID) != EE_SOH_MAGIC){
+        return; //Fresh pack
+    }
+    sohCap = (long)eepromReadWord(EE_SOH_CAPACITY) * 3600;
+    throughput = eepromReadLong(EE_SOH_THROUGHPUT);
+    discharged = eepromReadLong(EE_SOH_DISCHARGED);
+    energy = eepromReadLong(EE_SOH_ENERGY);
+    if(sohCap < rated / 100 * SOH_CAPACITY_MIN || sohCap > rated / 100 * SOH_CAPACITY_MAX){
+        sohCap = rated; //Corrupt, start over
+    }
+}
+
+//Counts one current sample (mA) over dt (mS). packVoltage is in mV
+void sohUpdate(long current, unsigned int packVoltage, unsigned long dt){
+    if(dt > SOH_MAX_DT){
+        dt = SOH_MAX_DT;
+    }
+
+    anchorRemainder += current * (long)dt; //Net charge since the anchor
+    anchorCharge += anchorRemainder / 1000;
+    anchorRemainder = anchorRemainder % 1000;
+
+    unsigned long step = (unsigned long)(current < 0 ? -current : current) * dt; //mA*mS
+    throughputRemainder += step;
+    if(current > 0){
+        dischargeRemainder += step;
+        if(dischargeRemainder >= 3600000){
+            discharged += dischargeRemainder / 3600000;
+            dischargeRemainder = dischargeRemainder % 3600000;
+        }
+    }
+    if(throughputRemainder >= 3600000){ //Whole mAh, energy is counted with them
+        unsigned long mah = throughputRemainder / 3600000;
+        throughputRemainder = throughputRemainder % 3600000;
+        throughput += mah;
+        energyRemainder += mah * packVoltage;
+        energy += energyRemainder / 1000;
+        energyRemainder = energyRemainder % 1000;
+    }
+}
+
+//Call with the OCV SOC (0.01%) each time the pack is rested. Returns 1 if the
+//capacity was updated so the SOC estimators can pick it up
+char sohAnchor(int soc){
+    char updated = 0;
+    int dSoc = anchorSoc - soc; //Discharge is positive, same as the charge
+
+    if(anchorValid && (dSoc >= SOH_MIN_DSOC || dSoc <= -SOH_MIN_DSOC)){
+        long measured = anchorCharge / dSoc * SOC_FULL;
+        if(measured >= ratedCapacity / 100 * SOH_CAPACITY_MIN && measured <= ratedCapacity / 100 * SOH_CAPACITY_MAX){
+            sohCap += (measured - sohCap) / SOH_BLEND;
+            sohChanged = 1;
+            updated = 1;
+        }
+    }else if(anchorValid && (anchorCharge > sohCap / 100 || anchorCharge < -sohCap / 100)){
+        return 0; //A different rest without enough swing, keep the older anchor
+    }
+
+    anchorSoc = soc; //Start over from here (also tracks the settling voltage within one rest)
+    anchorCharge = 0;
+    anchorRemainder = 0;
+    anchorValid = 1;
+    return updated;
+}
+
+//Saves to EEPROM when the capacity moved or SOH_SAVE_PERIOD has passed
+void sohSave(unsigned long now){
+    if(!sohChanged && now - lastSave < SOH_SAVE_PERIOD){
+        return;
+    }
+    eepromWriteWord(EE_SOH_CAPACITY, (unsigned int)(sohCap / 3600)); //Only changed bytes are written
+    eepromWriteLong(EE_SOH_THROUGHPUT, throughput);
+    eepromWriteLong(EE_SOH_DISCHARGED, discharged);
+    eepromWriteLong(EE_SOH_ENERGY, energy);
+    eepromWrite(EE_SOH_VALID, EE_SOH_MAGIC);
+    sohChanged = 0;
+    lastSave = now;
+}
+
+//Returns the effective capacity in mA*s
+long sohCapacity(){
+    return sohCap;
+}
+
+//Returns the capacity as a share of rated in 0.1%
+unsigned int sohHealth(){
+    return (unsigned int)(sohCap / (ratedCapacity / 1000));
+}
+
+//Returns equivalent full cycles (lifetime charge out / rated capacity)
+unsigned int sohCycles(){
+    return (unsigned int)(discharged / (unsigned long)(ratedCapacity / 3600));
+}
+
+//Returns lifetime charge in and out in mAh
+unsigned long sohThroughput(){
+    return throughput;
+}
+
+//Returns lifetime energy in and out in mWh
+unsigned long sohEnergy(){
+    return energy;
+}
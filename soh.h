@@ -0,0 +1,57 @@
+/* Microchip Technology Inc. and its subsidiaries.  You may use this software
+ * and any derivatives exclusively with Microchip products.
+ *
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+ * TERMS.
+ */
+
+/*
+ * File: soh
+ * Author: Tyler Matthews
+ * Comments: State of health. Capacity is measured from the charge counted
+ *           between two rested (OCV anchored) SOC points far enough apart,
+ *           and blended into the effective capacity the SOC estimators use.
+ *           Also keeps lifetime charge/energy throughput and equivalent full
+ *           cycles. Everything is saved to EEPROM at most once every
+ *           SOH_SAVE_PERIOD, or when the capacity moves: hourly saves wear
+ *           the 100k cycle EEPROM out in ~11 years.
+ * Revision history:
+ */
+
+#ifndef SOH_H
+#define SOH_H
+
+//Defines
+    #define SOH_MIN_DSOC 5000 //0.01%, anchors must be at least 50% SOC apart to measure capacity
+    #define SOH_BLEND 4 //Each measurement moves the capacity 1/4 of the way
+    #define SOH_CAPACITY_MIN 50 //Percent of rated, measurements outside MIN..MAX are thrown away
+    #define SOH_CAPACITY_MAX 110
+    #define SOH_MAX_DT 30000 //mS, same clamp as the coulomb counter
+    #define SOH_SAVE_PERIOD 3600000 //mS (1 hour) between EEPROM saves
+
+//Prototypes
+    void sohInit(long rated);
+    void sohUpdate(long current, unsigned int packVoltage, unsigned long dt);
+    char sohAnchor(int soc);
+    void sohSave(unsigned long now);
+    long sohCapacity();
+    unsigned int sohHealth();
+    unsigned int sohCycles();
+    unsigned long sohThroughput();
+    unsigned long sohEnergy();
+
+#endif
@@ -0,0 +1,114 @@
+/*
+ * File:   sop.c
+ * Author: trm84
+ *
+ * Created on October 19, 2026, 3:30 PM
+ */
+
+#include "sop.h"
+#include "coulomb.h"
+
+unsigned int sopMinCell = 0; //Lowest connected cell in the last sweep (codes), 0 if none
+unsigned int sopMaxCell = 0; //Highest cell in the last sweep (codes)
+long sopDischargeLimit[2] = {0, 0}; //mA, indexed by window
+long sopChargeLimit[2] = {0, 0}; //mA, indexed by window
+char sopDerated = 0; //Set while a fault asks for derating
+
+//Q8 factor that is 0 at zero and 256 at full, linear between. Works in either direction
+int sopRamp(int x, int zero, int full){
+    long f = ((long)(x - zero) << 8) / (full - zero);
+    if(f < 0){
+        f = 0;
+    }else if(f > 256){
+        f = 256;
+    }
+    return (int)f;
+}
+
+//Current the cell can take before its voltage moves by head (codes) through resistance r (uOhm)
+long sopHeadroom(long head, long r){
+    if(head > SOP_HEAD_MAX){
+        head = SOP_HEAD_MAX;
+    }else if(head < -SOP_HEAD_MAX){
+        head = -SOP_HEAD_MAX;
+    }
+    return head * 100000 / r; //100uV / uOhm = 100A -> mA
+}
+
+long sopClamp(long limit, long max, int factor){
+    if(limit < 0){
+        limit = 0;
+    }else if(limit > max){
+        limit = max;
+    }
+    return (limit * factor) >> 8;
+}
+
+//Call after every cell sweep with the lowest and highest connected cell (codes, 0 if none)
+void sopCells(unsigned int minCell, unsigned int maxCell){
+    sopMinCell = minCell;
+    sopMaxCell = maxCell;
+}
+
+//Call with every current sample. Temps are the healthy sensor extremes (C),
+//soc is 0.01%, ir is the highest cell IR (uOhm, 0 if unknown). Nine long
+//divides a call: five in sopRamp() and four in sopHeadroom()
+void sopUpdate(long current, int tempLow, int tempHigh, int soc, unsigned int ir){
+    if(sopMinCell == 0){ //No cell data, nothing is allowed
+        sopDischargeLimit[SOP_2S] = sopDischargeLimit[SOP_10S] = 0;
+        sopChargeLimit[SOP_2S] = sopChargeLimit[SOP_10S] = 0;
+        return;
+    }
+
+    //Derating -- the tightest of temperature and SOC wins
+    int hot = sopRamp(tempHigh, SOP_TEMP_HIGH, SOP_TEMP_WARM);
+    int dischargeFactor = sopRamp(tempLow, SOP_TEMP_LOW, SOP_TEMP_COLD);
+    int chargeFactor = sopRamp(tempLow, SOP_TEMP_LOW, SOP_TEMP_CHARGE_COLD);
+    int socFactor = sopRamp(soc, 0, SOP_SOC_DISCHARGE_FULL);
+    if(hot < dischargeFactor){
+        dischargeFactor = hot;
+    }
+    if(socFactor < dischargeFactor){
+        dischargeFactor = socFactor;
+    }
+    socFactor = sopRamp(soc, SOC_FULL, SOP_SOC_CHARGE_FULL);
+    if(hot < chargeFactor){
+        chargeFactor = hot;
+    }
+    if(socFactor < chargeFactor){
+        chargeFactor = socFactor;
+    }
+    if(sopDerated){
+        dischargeFactor >>= SOP_DERATE_SHIFT;
+        chargeFactor >>= SOP_DERATE_SHIFT;
+    }
+
+    if(ir == 0){
+        ir = SOP_DEFAULT_IR;
+    }
+    long r2 = ((long)ir * SOP_R2_Q8) >> 8;
+    long r10 = ((long)ir * SOP_R10_Q8) >> 8;
+    long headDischarge = (long)sopMinCell - SOP_CELL_MIN;
+    long headCharge = SOP_CELL_MAX - (long)sopMaxCell;
+
+    //Discharge is positive current, so the present load is already inside the measured voltage
+    sopDischargeLimit[SOP_2S] = sopClamp(current + sopHeadroom(headDischarge, r2), SOP_MAX_DISCHARGE, dischargeFactor);
+    sopDischargeLimit[SOP_10S] = sopClamp(current + sopHeadroom(headDischarge, r10), SOP_MAX_DISCHARGE, dischargeFactor);
+    sopChargeLimit[SOP_2S] = sopClamp(sopHeadroom(headCharge, r2) - current, SOP_MAX_CHARGE, chargeFactor);
+    sopChargeLimit[SOP_10S] = sopClamp(sopHeadroom(headCharge, r10) - current, SOP_MAX_CHARGE, chargeFactor);
+}
+
+//Set by the fault engine, derating holds until it is cleared
+void sopDerate(char derate){
+    sopDerated = derate;
+}
+
+//Largest discharge current (mA) for the window
+long sopDischarge(char window){
+    return sopDischargeLimit[window];
+}
+
+//Largest charge current (mA, positive) for the window
+long sopCharge(char window){
+    return sopChargeLimit[window];
+}
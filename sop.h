@@ -0,0 +1,74 @@
+/* Microchip Technology Inc. and its subsidiaries.  You may use this software
+ * and any derivatives exclusively with Microchip products.
+ *
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+ * TERMS.
+ */
+
+/*
+ * File: sop
+ * Author: Tyler Matthews
+ * Comments: State of power. Largest discharge and charge current the pack
+ *           can hold for the next 2S and 10S without a cell crossing its
+ *           voltage limit, then derated for temperature and SOC so the load
+ *           can back off before a fault ever trips the contactor.
+ *           The limit is the present current plus the cell voltage headroom
+ *           over the resistance seen in that window. The weakest cell
+ *           voltage is paired with the highest IR, which errs low.
+ *           Currents are mA, voltages are raw LTC6804 codes (100uV),
+ *           resistance is uOhm, derating factors are Q8.
+ * Revision history:
+ */
+
+#ifndef SOP_H
+#define SOP_H
+
+//Defines
+    #define SOP_2S 0
+    #define SOP_10S 1
+
+    #define SOP_CELL_MIN 30000 //Codes (3.0V), lowest cell voltage under load
+    #define SOP_CELL_MAX 42000 //Codes (4.2V), highest cell voltage while charging
+    #define SOP_MAX_DISCHARGE 10000 //mA, same as the over current fault
+    #define SOP_MAX_CHARGE 6000 //mA, 0.5C
+    #define SOP_DEFAULT_IR 10000 //uOhm, used until the IR estimator has seen a step
+    #define SOP_HEAD_MAX 20000 //Codes, keeps headroom*100000 inside a long
+    #define SOP_DERATE_SHIFT 1 //A derate fault halves both limits
+
+    //Window resistance relative to IR (Q8): R0 + R1*(1 - e^(-t/tau)) with the EKF cell model
+    #define SOP_R2_Q8 269 //2S, 1.05 * R0
+    #define SOP_R10_Q8 315 //10S, 1.23 * R0
+
+    //Temperature derating (C), full limit between COLD and WARM, none at LOW and HIGH
+    #define SOP_TEMP_LOW 10
+    #define SOP_TEMP_COLD 15
+    #define SOP_TEMP_CHARGE_COLD 20 //Charging is held back further in the cold
+    #define SOP_TEMP_WARM 35
+    #define SOP_TEMP_HIGH 40
+
+    //SOC derating (0.01%)
+    #define SOP_SOC_DISCHARGE_FULL 1000 //Discharge ramps to 0 below 10%
+    #define SOP_SOC_CHARGE_FULL 9000 //Charge ramps to 0 above 90%
+
+//Prototypes
+    void sopCells(unsigned int minCell, unsigned int maxCell);
+    void sopUpdate(long current, int tempLow, int tempHigh, int soc, unsigned int ir);
+    long sopDischarge(char window);
+    long sopCharge(char window);
+    void sopDerate(char derate);
+
+#endif
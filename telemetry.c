@@ -0,0 +1,416 @@
+/*
+ * File:   telemetry.c
+ * Author: trm84
+ *
+ * Created on October 19, 2026, 10:20 PM
+ */
+
+#include "telemetry.h"
+#include "uart.h"
+#include "delta.h"
+#include "timer.h"
+#include "sop.h"
+#include "trace.h"
+
+char tlmMode = TLM_DEFAULT;
+char tlmStream = 1; //Subscribed channels go out on their own
+unsigned int tlmSeq = 0; //Sequence number of the next frame, gaps show drops on the host
+unsigned char tlmFrame[TLM_MAX_FRAME]; //Raw frame before COBS
+const unsigned char tlmWire[TLM_CHANNELS] = {13, 17, 13, 13, 13, 14, 33, TLM_STATUS_SIZE + 2, 15}; //Bytes on the wire per frame: payload + header, CRC and COBS
+unsigned int tlmPeriods[TLM_CHANNELS] = {0, 0, 0, 0, 0, 0, 0, TLM_PERIOD, 0}; //mS, 0 is off
+unsigned int tlmDue[TLM_CHANNELS]; //Time (low 16 bits of mS) each channel is next due
+unsigned int tlmCellRef[12]; //Cell codes the host has, what the next delta frame is coded against
+unsigned int tlmCellSeq = 0; //Sequence number of the last cells frame
+unsigned char tlmKeyCount = 0; //Cells updates until the next key frame, 0 sends one next
+unsigned char tlmPack[TLM_DELTA_PACK*TLM_DELTA_LIMIT]; //Coded cells updates held for the next delta frame
+unsigned char tlmPackLength = 0;
+unsigned char tlmPackCount = 0; //Updates in tlmPack
+unsigned int tlmLoopLast = 0; //Time of the last pass (low 16 bits of mS)
+char tlmLoopRun = 0; //Set once tlmLoopLast is a real pass
+unsigned int tlmLoopPasses = 0; //Passes since the last loop frame
+unsigned int tlmLoopWindow = 0; //mS those passes took
+unsigned char tlmLoopMin = 255; //Shortest and longest pass (mS)
+unsigned char tlmLoopMax = 0;
+
+//Selects the ASCII dashboard or binary frames
+void telemetrySetMode(char mode){
+    tlmMode = mode;
+    tlmKeyCount = 0; //The host has to start over
+    tlmLoopRun = 0; //Passes in the other mode aren't seen
+}
+
+char telemetryMode(){
+    return tlmMode;
+}
+
+//Starts or stops the subscribed channels, replies and snapshots still go out
+void telemetryStream(char on){
+    tlmStream = on;
+    tlmKeyCount = 0;
+}
+
+//Makes the next cells frame a key frame, for a host that lost its reference
+void telemetryKey(){
+    tlmKeyCount = 0;
+}
+
+char telemetryStreaming(){
+    return tlmStream;
+}
+
+//Sets a channel's period in mS, 0 turns it off. Returns 0 and leaves the
+//subscriptions alone if the period is too short or the link can't carry it
+char telemetrySubscribe(char channel, unsigned int period, unsigned long now){
+    unsigned int old = tlmPeriods[channel];
+    if((period != 0 && period < TLM_MIN_PERIOD) || period > TLM_MAX_PERIOD){
+        return 0;
+    }
+    tlmPeriods[channel] = period;
+    if(telemetryLoad() > TLM_BUDGET){
+        tlmPeriods[channel] = old;
+        return 0;
+    }
+    tlmDue[channel] = (unsigned int)now;
+    if(channel == TLM_CH_CELLS){
+        tlmKeyCount = 0;
+    }
+    return 1;
+}
+
+unsigned int telemetryPeriod(char channel){
+    return tlmPeriods[channel];
+}
+
+//Returns the bytes/S the subscribed channels need
+unsigned int telemetryLoad(){
+    unsigned long load = 0;
+    for(int c = 0; c < TLM_CHANNELS; c++){
+        if(tlmPeriods[c] != 0){
+            load += ((unsigned long)tlmWire[c]*1000 + tlmPeriods[c] - 1) / tlmPeriods[c]; //Rounded up
+        }
+    }
+    return load > 0xFFFF ? 0xFFFF : (unsigned int)load;
+}
+
+//Sends every channel that is due. A frame that doesn't fit in the TX ring
+//stays due and goes out on a later pass, a little late rather than lost
+void telemetryService(unsigned long now, unsigned int codes[], unsigned int minCell, unsigned int maxCell, long current, int temps[], int soc, int ekfSoc, unsigned int faults, unsigned char actions, unsigned char sensors){
+    unsigned int time = (unsigned int)now;
+    unsigned int pass = time - tlmLoopLast;
+    tlmLoopLast = time;
+    if(tlmLoopRun){ //Called once a pass, so this is the loop period
+        tlmLoopPasses++;
+        tlmLoopWindow += pass;
+        if(pass > 255){
+            pass = 255;
+        }
+        if(pass < tlmLoopMin){
+            tlmLoopMin = (unsigned char)pass;
+        }
+        if(pass > tlmLoopMax){
+            tlmLoopMax = (unsigned char)pass;
+        }
+    }
+    tlmLoopRun = 1;
+    if(!tlmStream){
+        return;
+    }
+    for(char c = 0; c < TLM_CHANNELS; c++){
+        if(tlmPeriods[c] == 0 || (int)(time - tlmDue[c]) < 0){
+            continue;
+        }
+        if(uartRoom() < (c == TLM_CH_CELLS ? TLM_CELLS_ROOM : tlmWire[c])){
+            continue;
+        }
+        telemetryChannel(c, codes, minCell, maxCell, current, temps, soc, ekfSoc, faults, actions, sensors);
+        tlmDue[c] += tlmPeriods[c];
+        if((int)(time - tlmDue[c]) >= 0){ //Fell a whole period behind, don't send a burst to catch up
+            tlmDue[c] = time + tlmPeriods[c];
+        }
+    }
+}
+
+//Sends the held cells updates as one delta frame, named by the cells frame
+//the first builds on so a host that lost it knows. Returns 0 if it was
+//dropped, the chain starts again with a key frame
+char telemetryCellsDelta(){
+    int i = telemetryHeader(TLM_CELLS_DELTA);
+    tlmFrame[i++] = (unsigned char)tlmCellSeq;
+    tlmFrame[i++] = (unsigned char)(tlmCellSeq >> 8);
+    for(unsigned char b = 0; b < tlmPackLength; b++){
+        tlmFrame[i++] = tlmPack[b];
+    }
+    tlmCellSeq = tlmSeq - 1;
+    tlmPackLength = 0;
+    tlmPackCount = 0;
+    if(!telemetrySend(tlmFrame, i)){
+        tlmKeyCount = 0;
+        return 0;
+    }
+    return 1;
+}
+
+//Writes the type, sequence number and time, returns where the payload starts
+int telemetryHeader(unsigned char type){
+    unsigned int time = (unsigned int)getMillis();
+    tlmFrame[0] = type;
+    tlmFrame[1] = (unsigned char)tlmSeq;
+    tlmFrame[2] = (unsigned char)(tlmSeq >> 8);
+    tlmFrame[3] = (unsigned char)time;
+    tlmFrame[4] = (unsigned char)(time >> 8);
+    tlmSeq++;
+    return TLM_HEADER;
+}
+
+//Builds and sends one channel's frame. Returns 0 if it was dropped
+char telemetryChannel(char channel, unsigned int codes[], unsigned int minCell, unsigned int maxCell, long current, int temps[], int soc, int ekfSoc, unsigned int faults, unsigned char actions, unsigned char sensors){
+    int i;
+    int length;
+    switch(channel){
+        case TLM_CH_CURRENT:
+            i = telemetryHeader(TLM_CURRENT);
+            for(int b = 0; b < 4; b++){
+                tlmFrame[i++] = (unsigned char)(current >> (8*b));
+            }
+            break;
+        case TLM_CH_SOP: //Read here rather than passed in, sopUpdate() runs on every current sample
+            i = telemetryHeader(TLM_SOP);
+            for(char w = SOP_2S; w <= SOP_10S; w++){
+                long limit = sopDischarge(w);
+                tlmFrame[i++] = (unsigned char)limit;
+                tlmFrame[i++] = (unsigned char)(limit >> 8);
+            }
+            for(char w = SOP_2S; w <= SOP_10S; w++){
+                long limit = sopCharge(w);
+                tlmFrame[i++] = (unsigned char)limit;
+                tlmFrame[i++] = (unsigned char)(limit >> 8);
+            }
+            break;
+        case TLM_CH_MINMAX:
+            i = telemetryHeader(TLM_MINMAX);
+            tlmFrame[i++] = (unsigned char)minCell;
+            tlmFrame[i++] = (unsigned char)(minCell >> 8);
+            tlmFrame[i++] = (unsigned char)maxCell;
+            tlmFrame[i++] = (unsigned char)(maxCell >> 8);
+            break;
+        case TLM_CH_SOC:
+            i = telemetryHeader(TLM_SOC);
+            tlmFrame[i++] = (unsigned char)soc;
+            tlmFrame[i++] = (unsigned char)(soc >> 8);
+            tlmFrame[i++] = (unsigned char)ekfSoc;
+            tlmFrame[i++] = (unsigned char)(ekfSoc >> 8);
+            break;
+        case TLM_CH_FAULTS:
+            i = telemetryHeader(TLM_FAULTS);
+            tlmFrame[i++] = (unsigned char)faults;
+            tlmFrame[i++] = (unsigned char)(faults >> 8);
+            tlmFrame[i++] = actions;
+            tlmFrame[i++] = sensors;
+            break;
+        case TLM_CH_TEMPS:
+            i = telemetryHeader(TLM_TEMPS);
+            for(int t = 0; t < 5; t++){
+                tlmFrame[i++] = (unsigned char)temps[t];
+            }
+            break;
+        case TLM_CH_CELLS:
+            if(tlmKeyCount == 0){ //Restarted, what is held builds on a chain the host dropped
+                tlmPackLength = 0;
+                tlmPackCount = 0;
+            }else{
+                length = deltaEncode(codes, tlmCellRef, 12, &tlmPack[tlmPackLength], TLM_DELTA_LIMIT);
+                if(length != 0){ //Held until TLM_DELTA_PACK updates or the next key frame is due
+                    tlmPackLength += length;
+                    tlmPackCount++;
+                    tlmKeyCount--;
+                    if(tlmPackCount < TLM_DELTA_PACK && tlmKeyCount != 0){
+                        return 1;
+                    }
+                    return telemetryCellsDelta();
+                }
+                if(tlmPackCount != 0 && !telemetryCellsDelta()){ //What is held goes ahead of the key frame
+                    return 0;
+                }
+            }
+            //Key frame, every TLM_KEY_INTERVAL updates or when the changes don't code small enough
+            tlmCellSeq = tlmSeq;
+            i = telemetryHeader(TLM_CELLS);
+            for(int c = 0; c < 12; c++){
+                tlmFrame[i++] = (unsigned char)codes[c];
+                tlmFrame[i++] = (unsigned char)(codes[c] >> 8);
+                tlmCellRef[c] = codes[c];
+            }
+            tlmKeyCount = TLM_KEY_INTERVAL - 1;
+            if(!telemetrySend(tlmFrame, i)){
+                tlmKeyCount = 0; //The host never got it, start the chain again
+                return 0;
+            }
+            return 1;
+        case TLM_CH_LOOP:
+            i = telemetryHeader(TLM_LOOP);
+            tlmFrame[i++] = (unsigned char)tlmLoopPasses;
+            tlmFrame[i++] = (unsigned char)(tlmLoopPasses >> 8);
+            tlmFrame[i++] = (unsigned char)tlmLoopWindow;
+            tlmFrame[i++] = (unsigned char)(tlmLoopWindow >> 8);
+            tlmFrame[i++] = tlmLoopMin;
+            tlmFrame[i++] = tlmLoopMax;
+            tlmLoopPasses = 0;
+            tlmLoopWindow = 0;
+            tlmLoopMin = 255;
+            tlmLoopMax = 0;
+            break;
+        default:
+            return telemetryStatus(codes, current, temps, soc, ekfSoc, faults, actions, sensors);
+    }
+    return telemetrySend(tlmFrame, i);
+}
+
+//Sends the header of a burst current capture
+char telemetryCaptureInfo(unsigned int period, unsigned char samples, unsigned char pre, unsigned long time, int offset, int gain, long threshold){
+    int i = telemetryHeader(TLM_CAPTURE_INFO);
+    tlmFrame[i++] = (unsigned char)period;
+    tlmFrame[i++] = (unsigned char)(period >> 8);
+    tlmFrame[i++] = samples;
+    tlmFrame[i++] = pre;
+    for(int b = 0; b < 4; b++){
+        tlmFrame[i++] = (unsigned char)(time >> (8*b));
+    }
+    tlmFrame[i++] = (unsigned char)offset;
+    tlmFrame[i++] = (unsigned char)(offset >> 8);
+    tlmFrame[i++] = (unsigned char)gain;
+    tlmFrame[i++] = (unsigned char)(gain >> 8);
+    if(threshold > 32767){
+        threshold = 32767;
+    }
+    tlmFrame[i++] = (unsigned char)threshold;
+    tlmFrame[i++] = (unsigned char)(threshold >> 8);
+    return telemetrySend(tlmFrame, i);
+}
+
+//Sends count raw codes of a capture starting at sample first
+char telemetryCaptureData(unsigned char first, unsigned int codes[], unsigned char count){
+    int i = telemetryHeader(TLM_CAPTURE_DATA);
+    tlmFrame[i++] = first;
+    for(unsigned char c = 0; c < count; c++){
+        tlmFrame[i++] = (unsigned char)codes[c];
+        tlmFrame[i++] = (unsigned char)(codes[c] >> 8);
+    }
+    return telemetrySend(tlmFrame, i);
+}
+
+//Sends count black box records (count*TRACE_RECORD_SIZE bytes of data) that
+//start at record first of a dump of records. Polled, see telemetrySendPolled()
+void telemetryTrace(unsigned char version, unsigned char records, unsigned char frozen, unsigned char first, unsigned char data[], unsigned char count){
+    int i = telemetryHeader(TLM_TRACE);
+    tlmFrame[i++] = version;
+    tlmFrame[i++] = records;
+    tlmFrame[i++] = frozen;
+    tlmFrame[i++] = first;
+    for(int b = 0; b < count*TRACE_RECORD_SIZE; b++){
+        tlmFrame[i++] = data[b];
+    }
+    telemetrySendPolled(tlmFrame, i);
+}
+
+//Sends a command reply as a frame so it can't break up the binary stream
+void telemetryReply(const char *text, int length){
+    int i = 0;
+    if(length > TLM_MAX_FRAME - 3){
+        length = TLM_MAX_FRAME - 3;
+    }
+    tlmFrame[i++] = TLM_REPLY;
+    for(int c = 0; c < length; c++){
+        tlmFrame[i++] = text[c];
+    }
+    telemetrySend(tlmFrame, i);
+}
+
+//CRC-16/CCITT, bitwise -- ~8 shifts per byte keeps it out of the 512 byte table
+unsigned int crc16(unsigned char data[], int length){
+    unsigned int crc = 0xFFFF;
+    for(int i = 0; i < length; i++){
+        crc ^= (unsigned int)data[i] << 8;
+        for(int b = 0; b < 8; b++){
+            if(crc & 0x8000){
+                crc = (crc << 1) ^ 0x1021;
+            }else{
+                crc <<= 1;
+            }
+        }
+    }
+    return crc;
+}
+
+//COBS encodes length bytes into out (no zeros) and adds the 0x00 delimiter.
+//Returns the bytes written, at most length + 2 for frames under 254 bytes
+int cobsEncode(unsigned char in[], int length, unsigned char out[]){
+    int code = 0; //Where the current run's length byte goes
+    int o = 1;
+    unsigned char run = 1;
+    for(int i = 0; i < length; i++){
+        if(in[i] == 0){
+            out[code] = run;
+            code = o++;
+            run = 1;
+        }else{
+            out[o++] = in[i];
+            run++;
+            if(run == 0xFF){ //Longest run a length byte can hold
+                out[code] = run;
+                code = o++;
+                run = 1;
+            }
+        }
+    }
+    out[code] = run;
+    out[o++] = 0x00;
+    return o;
+}
+
+//Adds the CRC, encodes the frame into str and queues it. The console is off
+//in binary mode so str is free. A frame that doesn't fit is dropped and counted
+char telemetrySend(unsigned char frame[], int length){
+    unsigned int crc = crc16(frame, length);
+    frame[length] = (unsigned char)crc;
+    frame[length + 1] = (unsigned char)(crc >> 8);
+
+    return uartWrite((unsigned char *)str, cobsEncode(frame, length + 2, (unsigned char *)str));
+}
+
+//As telemetrySend() but waits for the ring to empty and polls the frame out,
+//for dumps that run before the UART interrupt does or that a full ring would drop
+void telemetrySendPolled(unsigned char frame[], int length){
+    unsigned int crc = crc16(frame, length);
+    frame[length] = (unsigned char)crc;
+    frame[length + 1] = (unsigned char)(crc >> 8);
+
+    int wire = cobsEncode(frame, length + 2, (unsigned char *)str);
+    uartWait();
+    for(int b = 0; b < wire; b++){
+        uartPutc((unsigned char)str[b]);
+    }
+}
+
+//Builds and sends one status frame. Returns 0 if it was dropped
+char telemetryStatus(unsigned int codes[], long current, int temps[], int soc, int ekfSoc, unsigned int faults, unsigned char actions, unsigned char sensors){
+    int i = telemetryHeader(TLM_STATUS);
+    for(int c = 0; c < 12; c++){
+        tlmFrame[i++] = (unsigned char)codes[c];
+        tlmFrame[i++] = (unsigned char)(codes[c] >> 8);
+    }
+    for(int b = 0; b < 4; b++){
+        tlmFrame[i++] = (unsigned char)(current >> (8*b));
+    }
+    for(int t = 0; t < 5; t++){
+        tlmFrame[i++] = (unsigned char)temps[t];
+    }
+    tlmFrame[i++] = (unsigned char)soc;
+    tlmFrame[i++] = (unsigned char)(soc >> 8);
+    tlmFrame[i++] = (unsigned char)ekfSoc;
+    tlmFrame[i++] = (unsigned char)(ekfSoc >> 8);
+    tlmFrame[i++] = (unsigned char)faults;
+    tlmFrame[i++] = (unsigned char)(faults >> 8);
+    tlmFrame[i++] = actions;
+    tlmFrame[i++] = sensors;
+    return telemetrySend(tlmFrame, i);
+}
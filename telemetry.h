@@ -0,0 +1,154 @@
+/* Microchip Technology Inc. and its subsidiaries.  You may use this software
+ * and any derivatives exclusively with Microchip products.
+ *
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+ * TERMS.
+ */
+
+/*
+ * File: telemetry
+ * Author: Tyler Matthews
+ * Comments: Binary telemetry. Every frame but a reply starts with the
+ *           same header, so the host can see both lost and late frames:
+ *             0     type
+ *             1-2   sequence number, one counter shared by every frame
+ *             3-4   time the frame was built (mS, low 16 bits)
+ *           One status frame carries the raw fixed point values the ASCII
+ *           dashboard spends ~800 characters on:
+ *             5-28  cell codes (100uV) x12
+ *             29-32 current (mA, signed)
+ *             33-37 temperatures (C, signed) x5
+ *             38-39 SOC (0.01%)          40-41 EKF SOC (0.01%)
+ *             42-43 fault bits           44 fault actions   45 failed sensors
+ *             46-47 CRC-16/CCITT (0x1021, init 0xFFFF) over bytes 0-45
+ *           The host can also subscribe to single channels at their own
+ *           rates, each frame being the header, payload and CRC:
+ *             TLM_CURRENT 0x10  current (mA, signed, 4 bytes)
+ *             TLM_SOP     0x18  discharge 2S, discharge 10S, charge 2S,
+ *                               charge 10S limits (mA), from the state of
+ *                               power as of the last current sample, so a
+ *                               load can throttle at the sample rate
+ *             TLM_MINMAX  0x11  lowest, highest cell code
+ *             TLM_SOC     0x12  SOC, EKF SOC (0.01%)
+ *             TLM_FAULTS  0x13  fault bits, actions, failed sensors
+ *             TLM_TEMPS   0x14  temperatures (C, signed) x5
+ *             TLM_CELLS   0x15  cell codes x12, a key frame
+ *             TLM_CELLS_DELTA 0x16  sequence number of the cells frame it
+ *                               builds on, then the changes of up to
+ *                               TLM_DELTA_PACK updates one period apart,
+ *                               oldest first, each against the one before
+ *                               (delta.h). The time is the newest's
+ *             TLM_LOOP    0x17  main loop passes and the mS they took since
+ *                               the last loop frame, shortest and longest
+ *                               pass (mS)
+ *           Cells go out as a key frame every TLM_KEY_INTERVAL updates and
+ *           deltas in between, held back to share a frame so the header
+ *           and CRC are paid once per TLM_DELTA_PACK updates. A host that
+ *           missed the frame a delta builds on waits for the next key
+ *           frame, or asks for one with "key".
+ *           A burst current capture (capture.h) goes out as one
+ *           TLM_CAPTURE_INFO frame and then TLM_CAPTURE_DATA frames of raw
+ *           codes. In binary mode a black box dump (trace.h) goes out as
+ *           TLM_TRACE frames rather than raw bytes: version, records in the
+ *           dump, frozen, index of the first record in this frame, then up
+ *           to TLM_TRACE_RECORDS records oldest first. A subscription is
+ *           refused if the channels together would
+ *           need more than TLM_BUDGET of the link. A TLM_REPLY frame is the
+ *           type byte, the text of a command reply and the CRC.
+ *           All little endian. The frame is COBS encoded and ends in 0x00,
+ *           so a receiver can resync at any zero. 50 bytes on the wire is
+ *           ~3mS at 166kBaud, against ~48mS for the dashboard.
+ *           tools/tlm_decode.cpp decodes and pretty prints the stream and
+ *           sums up drops, frame timing and loop timing.
+ * Revision history:
+ */
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+//Defines
+    #define TLM_ASCII 0 //Human readable dashboard every UART_PERIOD
+    #define TLM_BINARY 1 //Subscribed channels
+    #define TLM_DEFAULT TLM_BINARY
+
+    #define TLM_PERIOD 50 //mS, 20Hz status frames until the host subscribes to something else
+    #define TLM_MIN_PERIOD 10 //mS, about one frame per channel per main loop pass
+    #define TLM_MAX_PERIOD 32767 //mS, due times are 16 bits compared as a signed difference
+    #define TLM_LINK 16667 //Bytes/S, 166667 baud at 10 bits a byte
+    #define TLM_BUDGET 13333 //Bytes/S the channels may use, the rest is for replies and bursts
+
+    #define TLM_STATUS 0x01 //Frame types
+    #define TLM_REPLY 0x02
+    #define TLM_CURRENT 0x10
+    #define TLM_MINMAX 0x11
+    #define TLM_SOC 0x12
+    #define TLM_FAULTS 0x13
+    #define TLM_TEMPS 0x14
+    #define TLM_CELLS 0x15
+    #define TLM_CELLS_DELTA 0x16
+    #define TLM_LOOP 0x17
+    #define TLM_SOP 0x18
+    #define TLM_KEY_INTERVAL 16 //Cells updates per key frame
+    #define TLM_DELTA_PACK 5 //Cells updates per delta frame
+    #define TLM_DELTA_LIMIT 11 //Coded bytes per update, TLM_DELTA_PACK of them fill a TLM_MAX_FRAME frame
+    #define TLM_CELLS_ROOM (TLM_MAX_FRAME + 2) //TX ring room a cells update waits for, a full delta frame on the wire
+    #define TLM_CAPTURE_INFO 0x20
+    #define TLM_CAPTURE_DATA 0x21
+    #define TLM_CAPTURE_INFO_WIRE 23 //Bytes on the wire
+    #define TLM_CAPTURE_DATA_WIRE 42 //With 16 samples
+    #define TLM_TRACE 0x22
+    #define TLM_TRACE_RECORDS 6 //Trace records per frame, 59 bytes raw
+
+    #define TLM_CH_CURRENT 0 //Channels, checked in this order each pass so the fast ones go first
+    #define TLM_CH_SOP 1
+    #define TLM_CH_MINMAX 2
+    #define TLM_CH_SOC 3
+    #define TLM_CH_FAULTS 4
+    #define TLM_CH_TEMPS 5
+    #define TLM_CH_CELLS 6
+    #define TLM_CH_STATUS 7
+    #define TLM_CH_LOOP 8
+    #define TLM_CHANNELS 9
+    #define TLM_HEADER 5 //Type, sequence number and time
+    #define TLM_STATUS_PAYLOAD 41 //Bytes 5-45 above
+    #define TLM_STATUS_SIZE (TLM_HEADER + TLM_STATUS_PAYLOAD + 2) //Raw, including the CRC
+    #define TLM_MAX_FRAME 64 //Largest raw frame, COBS adds one byte per 254 plus the 0x00
+
+//Prototypes
+    void telemetrySetMode(char mode);
+    char telemetryMode();
+    void telemetryStream(char on);
+    char telemetryStreaming();
+    void telemetryKey();
+    void telemetryReply(const char *text, int length);
+    char telemetrySubscribe(char channel, unsigned int period, unsigned long now);
+    unsigned int telemetryPeriod(char channel);
+    unsigned int telemetryLoad();
+    void telemetryService(unsigned long now, unsigned int codes[], unsigned int minCell, unsigned int maxCell, long current, int temps[], int soc, int ekfSoc, unsigned int faults, unsigned char actions, unsigned char sensors);
+    char telemetryChannel(char channel, unsigned int codes[], unsigned int minCell, unsigned int maxCell, long current, int temps[], int soc, int ekfSoc, unsigned int faults, unsigned char actions, unsigned char sensors);
+    char telemetryStatus(unsigned int codes[], long current, int temps[], int soc, int ekfSoc, unsigned int faults, unsigned char actions, unsigned char sensors);
+    char telemetryCellsDelta();
+    char telemetrySend(unsigned char frame[], int length);
+    unsigned int crc16(unsigned char data[], int length);
+    int cobsEncode(unsigned char in[], int length, unsigned char out[]);
+    int telemetryHeader(unsigned char type);
+    char telemetryCaptureInfo(unsigned int period, unsigned char samples, unsigned char pre, unsigned long time, int offset, int gain, long threshold);
+    char telemetryCaptureData(unsigned char first, unsigned int codes[], unsigned char count);
+    void telemetryTrace(unsigned char version, unsigned char records, unsigned char frozen, unsigned char first, unsigned char data[], unsigned char count);
+    void telemetrySendPolled(unsigned char frame[], int length);
+
+#endif
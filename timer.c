@@ -1,25 +1,71 @@
-/*
- * File:   timer.c
- * Author: trm84
- *
- * Created on February 7, 2019, 11:36 AM
- */
-
-#include "timer.h"
-
-void timerSetup(){
-    timer0Setup();
-    timer2Setup();
-}
-
-void timer2Setup(){
-    CCP2CON = 0x06; //Generate Software Interrupt only
-    PIE1bits.TMR2IE = 1; //Timer 2 Interrupt Enable
-    PR2 = 254; //255 - 2 gives 5mS timer
-    T2CON = 0x4F; // Postscaler = 1:16, Prescaler = 64, Timer2 is on
-}
-
-void timer0Setup(){
-    OPTION_REG = 0b10001110; //1110 = 1:128
-    INTCONbits.TMR0IE = 1; //TIMER0 INTERRUPT EN
+/*
+ * File:   timer.c
+ * Author: trm84
+ *
+ * Created on February 7, 2019, 11:36 AM
+ */
+
+#include "timer.h"
+#include "capture.h"
+
+volatile unsigned long millis = 0; //System clock in mS
+unsigned int microFraction = 0; //uS left over from each 1.024mS overflow
+volatile unsigned long isrCycles = 0; //Instruction cycles spent in the ISR
+unsigned long loadStart = 0; //Start of the current ISR load window (mS)
+
+void timerSetup(){
+    timer0Setup();
+    timer1Setup();
+    timer2Setup();
+}
+
+void timer0Setup(){
+    OPTION_REG = 0b10000100; //Prescaler assigned to Timer0, 100 = 1:32 -> overflow every 1.024mS
+    INTCONbits.TMR0IE = 1; //TIMER0 INTERRUPT EN
+}
+
+void timer1Setup(){
+    T1CON = 0x01; //Clock = FOSC/4, Prescaler = 1:1, Timer1 is on -- free running cycle counter, no interrupt
+}
+
+void timer2Setup(){
+    PR2 = CAPTURE_PR2; //CAPTURE_PERIOD
+    T2CON = 0x01; //Postscaler = 1:1, Timer2 is off, Prescaler = 1:4 -- captureArm() turns it on
+    PIE1bits.TMR2IE = 0;
+}
+
+//Returns the system clock in mS. The ISR is held off while the 4 bytes are
+//copied so the value can't tear on the 8 bit core
+unsigned long getMillis(){
+    unsigned long now;
+    
+    INTCONbits.TMR0IE = 0;
+    now = millis;
+    INTCONbits.TMR0IE = 1;
+    return now;
+}
+
+//Returns Timer1 (instruction cycles, wraps every 8.2mS)
+unsigned int readTimer1(){
+    unsigned int count;
+    TIMER1_READ(count);
+    return count;
+}
+
+//Returns the share of the CPU spent in the ISR since the last call in 0.1%
+unsigned int getIsrLoad(){
+    unsigned long cycles;
+    unsigned long now = getMillis();
+    unsigned long elapsed = now - loadStart;
+    
+    INTCONbits.GIE = 0;
+    cycles = isrCycles;
+    isrCycles = 0;
+    INTCONbits.GIE = 1;
+    
+    loadStart = now;
+    if(elapsed == 0){
+        return 0;
+    }
+    return (unsigned int)((cycles / elapsed) * 1000 / CYCLES_PER_MS);
 }
\ No newline at end of file
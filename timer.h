@@ -1,42 +1,94 @@
-/* Microchip Technology Inc. and its subsidiaries.  You may use this software 
- * and any derivatives exclusively with Microchip products. 
- * 
- * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
- * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
- * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
- * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
- * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
- *
- * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
- * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
- * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
- * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
- * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
- * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
- * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
- *
- * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
- * TERMS. 
- */
-
-/* 
- * File: timer
- * Author: Tyler Matthews
- * Comments: Timer interrupts are used to time various features (ie: current measurement)
- * Revision history: 
- */
-
-
-
-//Includes
-    #include <xc.h> // include processor files - each processor file is guarded.  
-
-//Defines
-    #define _XTAL_FREQ 32000000
-
-//Prototypes
-    void timer0Setup();
-    void timer2Setup();
-    void timerSetup();
-    
-//Variables
\ No newline at end of file
+/* Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ */
+
+/* 
+ * File: timer
+ * Author: Tyler Matthews
+ * Comments: Timer0 drives the system millisecond clock. Every module that needs
+ *           to know the time (dt integration, timeouts, timestamps) reads it
+ *           through getMillis(). Timer2 paces the burst current capture
+ *           (capture.h), it only runs while a capture is armed.
+ * Revision history: 
+ */
+
+
+
+//Includes
+    #include <xc.h> // include processor files - each processor file is guarded.  
+
+//Defines
+    #define _XTAL_FREQ 32000000
+    #define TICK_US 1024 //Timer0 overflow period: 256 counts of FOSC/4/32 = 4uS
+    #define CYCLES_PER_MS 8000 //Instruction cycles (FOSC/4) per mS
+
+    //Advances the system clock, called from the ISR on every Timer0 overflow.
+    //The extra 24uS per overflow is accumulated so the clock doesn't drift.
+    //A macro so the tick doesn't pay for a call from interrupt context
+    #define TIMER_TICK() do{ \
+        millis++; \
+        microFraction += TICK_US - 1000; \
+        if(microFraction >= 1000){ \
+            millis++; \
+            microFraction -= 1000; \
+        } \
+    }while(0)
+
+    //Reads Timer1 into t without a call. The high byte is read again in
+    //case the low byte rolled over between the two reads
+    #define TIMER1_READ(t) do{ \
+        unsigned char timer1High = TMR1H; \
+        t = ((unsigned int)timer1High << 8) | TMR1L; \
+        if(TMR1H != timer1High){ \
+            t = ((unsigned int)TMR1H << 8) | TMR1L; \
+        } \
+    }while(0)
+
+    //ISR profiling: Timer1 counts instruction cycles so the time spent in
+    //the ISR can be reported as a share of the CPU. Off by default, the
+    //hooks cost two Timer1 reads on every interrupt. Set to 1 to measure,
+    //getIsrLoad() returns 0 while it is off and the console shows n/a
+    #define ISR_PROFILE 0
+    #define ISR_ENTRY_CYCLES 20 //Latency, context save/restore and RETFIE not seen by Timer1
+    #if ISR_PROFILE
+        #define ISR_PROFILE_START() unsigned int isrStart; TIMER1_READ(isrStart)
+        #define ISR_PROFILE_END() do{ \
+            unsigned int isrEnd; \
+            TIMER1_READ(isrEnd); \
+            isrCycles += (unsigned int)(isrEnd - isrStart) + ISR_ENTRY_CYCLES; \
+        }while(0)
+    #else
+        #define ISR_PROFILE_START()
+        #define ISR_PROFILE_END()
+    #endif
+
+//Prototypes
+    void timer0Setup();
+    void timer1Setup();
+    void timer2Setup();
+    void timerSetup();
+    unsigned long getMillis();
+    unsigned int readTimer1();
+    unsigned int getIsrLoad();
+    
+//Variables
+    extern volatile unsigned long millis; //System clock in mS, only read through getMillis()
+    extern unsigned int microFraction; //uS left over from each 1.024mS overflow
+    extern volatile unsigned long isrCycles; //Instruction cycles spent in the ISR
\ No newline at end of file
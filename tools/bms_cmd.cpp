@@ -0,0 +1,174 @@
+/*
+ * File:   bms_cmd.cpp
+ * Author: trm84
+ *
+ * Created on October 20, 2026, 1:45 AM
+ *
+ * Host client for the command interface (see command.h). Sends one command
+ * line and prints the reply, whether the BMS is in binary mode (a TLM_REPLY
+ * frame) or ASCII mode (the console's message line). Exits 0 on "ok", 1 on
+ * "err" and 2 if nothing came back. Everything received can be saved with
+ * -o, ie: to feed a trace dump to trace_decode.
+ *
+ * Build: g++ -std=c++17 -O2 -o bms_cmd bms_cmd.cpp
+ * Use:   bms_cmd [-o capture.bin] /dev/ttyUSB0 set ov 4200
+ *        Works on a pty as well, the baud rate is ignored there.
+ */
+
+#include <asm/termbits.h>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <string>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+const int kBaud = 166667;        // 32MHz / (64 * (SPBRG + 1)), SPBRG = 2
+const int kTimeoutMs = 1000;
+const uint8_t kTypeReply = 0x02;
+const char kMessageRow[] = "\033[15;1H"; // CON_MESSAGE_ROW
+const char kClearLine[] = "\033[K";
+
+uint16_t crc16(const uint8_t *data, size_t length)
+{
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= static_cast<uint16_t>(data[i]) << 8;
+        for (int b = 0; b < 8; b++)
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+bool cobsDecode(const std::vector<uint8_t> &in, std::vector<uint8_t> &out)
+{
+    out.clear();
+    size_t i = 0;
+    while (i < in.size()) {
+        uint8_t code = in[i++];
+        if (code == 0 || i + code - 1 > in.size())
+            return false;
+        for (uint8_t k = 1; k < code; k++)
+            out.push_back(in[i++]);
+        if (code != 0xFF && i < in.size())
+            out.push_back(0);
+    }
+    return true;
+}
+
+// Raw 8N1 at the BMS's non standard rate, through termios2
+void configure(int fd)
+{
+    struct termios2 tio;
+    if (ioctl(fd, TCGETS2, &tio) != 0)
+        return;
+    tio.c_iflag = 0;
+    tio.c_oflag = 0;
+    tio.c_lflag = 0;
+    tio.c_cflag = CS8 | CREAD | CLOCAL | BOTHER;
+    tio.c_ispeed = kBaud;
+    tio.c_ospeed = kBaud;
+    tio.c_cc[VMIN] = 0;
+    tio.c_cc[VTIME] = 0;
+    ioctl(fd, TCSETS2, &tio);
+}
+
+// Looks for a reply in what has arrived so far, either framed or on the
+// console's message line
+bool findReply(const std::vector<uint8_t> &rx, std::string &reply)
+{
+    std::vector<uint8_t> raw;
+    std::vector<uint8_t> frame;
+    for (uint8_t byte : rx) {
+        if (byte != 0) {
+            raw.push_back(byte);
+            continue;
+        }
+        if (cobsDecode(raw, frame) && frame.size() >= 3 && frame[0] == kTypeReply &&
+            crc16(frame.data(), frame.size() - 2) ==
+                (frame[frame.size() - 2] | (frame[frame.size() - 1] << 8))) {
+            reply.assign(frame.begin() + 1, frame.end() - 2);
+            return true;
+        }
+        raw.clear();
+    }
+
+    std::string text(rx.begin(), rx.end());
+    size_t start = text.rfind(kMessageRow);
+    if (start == std::string::npos)
+        return false;
+    start += sizeof(kMessageRow) - 1;
+    size_t end = text.find(kClearLine, start);
+    if (end == std::string::npos)
+        return false;
+    reply = text.substr(start, end - start);
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const char *capture = nullptr;
+    int arg = 1;
+    if (arg + 1 < argc && std::strcmp(argv[arg], "-o") == 0) {
+        capture = argv[arg + 1];
+        arg += 2;
+    }
+    if (argc - arg < 2) {
+        std::fprintf(stderr, "use: bms_cmd [-o capture.bin] device command [args]\n");
+        return 2;
+    }
+
+    int fd = open(argv[arg], O_RDWR | O_NOCTTY);
+    if (fd < 0) {
+        std::perror(argv[arg]);
+        return 2;
+    }
+    configure(fd);
+
+    std::string line;
+    for (int i = arg + 1; i < argc; i++) {
+        if (!line.empty())
+            line += ' ';
+        line += argv[i];
+    }
+    line += '\r';
+    if (write(fd, line.data(), line.size()) != static_cast<ssize_t>(line.size())) {
+        std::perror("write");
+        return 2;
+    }
+
+    std::vector<uint8_t> rx;
+    std::string reply;
+    bool found = false;
+    struct pollfd pfd = {fd, POLLIN, 0};
+    while (!found && poll(&pfd, 1, kTimeoutMs) > 0) {
+        uint8_t buf[256];
+        ssize_t n = read(fd, buf, sizeof(buf));
+        if (n <= 0)
+            break;
+        rx.insert(rx.end(), buf, buf + n);
+        found = findReply(rx, reply);
+    }
+    close(fd);
+
+    if (capture) {
+        FILE *out = std::fopen(capture, "wb");
+        if (out) {
+            std::fwrite(rx.data(), 1, rx.size(), out);
+            std::fclose(out);
+        }
+    }
+    if (!found) {
+        std::fprintf(stderr, "no reply\n");
+        return 2;
+    }
+    std::printf("%s\n", reply.c_str());
+    return reply.compare(0, 2, "ok") == 0 ? 0 : 1;
+}
@@ -0,0 +1,179 @@
+/*
+ * File:   cap_wave.cpp
+ * Author: trm84
+ *
+ * Created on October 20, 2026, 4:20 AM
+ *
+ * Rebuilds burst current captures (see capture.h) from a raw capture of the
+ * binary telemetry stream. Other frames are skipped. Every capture becomes a
+ * block of CSV rows: sample number, time from the trigger (uS), time since
+ * boot (mS), raw ADC code and current (A) using the offset and gain the BMS
+ * sent with it. Samples are CAPTURE_PERIOD apart exactly, the boot time is
+ * only as good as the 1mS clock at the trigger. Captures with a missing or
+ * bad data frame are reported and left out.
+ *
+ * Build: g++ -std=c++17 -O2 -o cap_wave cap_wave.cpp
+ * Use:   bms_cmd /dev/ttyUSB0 cap 20000, then
+ *        cap_wave capture.bin > inrush.csv   (or pipe the serial port in)
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+const uint8_t kTypeInfo = 0x20;
+const uint8_t kTypeData = 0x21;
+const size_t kHeader = 5;           // Type, sequence number, time
+const size_t kInfoSize = 21;        // Including the CRC
+const int kGainShift = 8;           // CURRENT_GAIN_SHIFT in adc.h
+
+struct Capture {
+    bool open = false;
+    unsigned period = 0;            // uS
+    unsigned samples = 0;
+    unsigned pre = 0;
+    uint32_t time = 0;              // mS at the trigger
+    int offset = 0;
+    int gain = 0;
+    int threshold = 0;
+    std::vector<int> codes;
+    std::vector<bool> have;
+};
+
+uint16_t crc16(const uint8_t *data, size_t length)
+{
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= static_cast<uint16_t>(data[i]) << 8;
+        for (int b = 0; b < 8; b++)
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+// Decodes one COBS frame (without its 0x00). Returns false if it is malformed.
+bool cobsDecode(const std::vector<uint8_t> &in, std::vector<uint8_t> &out)
+{
+    out.clear();
+    size_t i = 0;
+    while (i < in.size()) {
+        uint8_t code = in[i++];
+        if (code == 0 || i + code - 1 > in.size())
+            return false;
+        for (uint8_t k = 1; k < code; k++)
+            out.push_back(in[i++]);
+        if (code != 0xFF && i < in.size())
+            out.push_back(0);
+    }
+    return true;
+}
+
+unsigned u16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+int s16(const uint8_t *p) { return static_cast<int16_t>(u16(p)); }
+
+// Prints a complete capture, or says what is missing
+void finish(Capture &cap, int &number)
+{
+    if (!cap.open)
+        return;
+    cap.open = false;
+    number++;
+    for (unsigned i = 0; i < cap.samples; i++) {
+        if (!cap.have[i]) {
+            std::fprintf(stderr, "capture %d at %u mS: sample %u missing, skipped\n",
+                         number, cap.time, i);
+            return;
+        }
+    }
+    std::printf("# capture %d: %u samples every %u uS, %u before the trigger, threshold %d mA\n",
+                number, cap.samples, cap.period, cap.pre, cap.threshold);
+    for (unsigned i = 0; i < cap.samples; i++) {
+        long us = (static_cast<long>(i) - static_cast<long>(cap.pre)) * cap.period;
+        long ma = (static_cast<long>(cap.codes[i] - cap.offset) * cap.gain) >> kGainShift;
+        std::printf("%d,%u,%ld,%.3f,%d,%.3f\n", number, i, us, cap.time + us / 1000.0,
+                    cap.codes[i], ma / 1000.0);
+    }
+    std::fprintf(stderr, "capture %d at %u mS: %u samples\n", number, cap.time, cap.samples);
+}
+
+void handleFrame(const std::vector<uint8_t> &raw, Capture &cap, int &number, size_t &bad)
+{
+    std::vector<uint8_t> frame;
+    if (!cobsDecode(raw, frame) || frame.size() < 3) {
+        bad++;
+        return;
+    }
+    size_t body = frame.size() - 2;
+    if (crc16(frame.data(), body) != u16(&frame[body])) {
+        bad++;
+        return;
+    }
+    const uint8_t *p = &frame[kHeader];
+    if (frame[0] == kTypeInfo && frame.size() == kInfoSize) {
+        finish(cap, number);        // A new capture ends the last one, complete or not
+        cap.open = true;
+        cap.period = u16(p);
+        cap.samples = p[2];
+        cap.pre = p[3];
+        cap.time = p[4] | (p[5] << 8) | (p[6] << 16) | (static_cast<uint32_t>(p[7]) << 24);
+        cap.offset = s16(p + 8);
+        cap.gain = s16(p + 10);
+        cap.threshold = s16(p + 12);
+        cap.codes.assign(cap.samples, 0);
+        cap.have.assign(cap.samples, false);
+        return;
+    }
+    if (frame[0] != kTypeData || !cap.open || body < kHeader + 1)
+        return;
+    unsigned first = p[0];
+    size_t count = (body - kHeader - 1) / 2;
+    for (size_t c = 0; c < count && first + c < cap.samples; c++) {
+        cap.codes[first + c] = u16(p + 1 + 2 * c);
+        cap.have[first + c] = true;
+    }
+    if (first + count >= cap.samples)
+        finish(cap, number);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::ifstream file;
+    if (argc > 1) {
+        file.open(argv[1], std::ios::binary);
+        if (!file) {
+            std::fprintf(stderr, "can't open %s\n", argv[1]);
+            return 1;
+        }
+    }
+    std::istream &in = argc > 1 ? file : std::cin;
+
+    Capture cap;
+    int number = 0;
+    size_t bad = 0;
+    std::vector<uint8_t> raw;
+    bool synced = false; // Bytes before the first 0x00 are a partial frame
+    char c;
+    std::printf("capture,sample,us,ms,code,amps\n");
+    while (in.get(c)) {
+        uint8_t byte = static_cast<uint8_t>(c);
+        if (byte != 0) {
+            raw.push_back(byte);
+            continue;
+        }
+        if (synced && !raw.empty())
+            handleFrame(raw, cap, number, bad);
+        synced = true;
+        raw.clear();
+    }
+    finish(cap, number);
+
+    if (bad)
+        std::fprintf(stderr, "%zu bad frames\n", bad);
+    return number == 0 ? 1 : 0;
+}
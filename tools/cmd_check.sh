@@ -0,0 +1,191 @@
+#!/bin/sh
+#
+# File:   cmd_check.sh
+# Author: trm84
+#
+# Created on October 20, 2026, 3:40 PM
+#
+# Drives the command parser (see command.h) through bms_cmd and checks the
+# reply to every verb, error paths included: params, get and set inside and
+# outside their ranges, malformed and overlong lines, sub against
+# TLM_MIN_PERIOD, TLM_MAX_PERIOD and TLM_BUDGET, stream, snap, key, trace,
+# reset, cap, and replies in both ASCII and binary mode.
+#
+# With no device it starts cmd_pty, the host build of the command interface,
+# and also checks what needs the hardware stubbed: cal with the contactors
+# closed, with current flowing, with a bad offset and with a capture
+# running, and a line that overflows the RX ring behind a slow pass.
+#
+# On the board anything it changes is put back: thresholds are only set to
+# what they already are or briefly moved inside their range, and the
+# subscriptions end as after a reset (status every TLM_PERIOD). cal is left
+# out there. It leaves the BMS in binary mode.
+#
+# Build: g++ -std=c++17 -O2 -o tools/bms_cmd tools/bms_cmd.cpp
+#        (cd tools && g++ -std=c++17 -O2 -funsigned-char -Ihost -o cmd_pty cmd_pty.cpp)
+# Use:   tools/cmd_check.sh [/dev/ttyUSB0]
+#        BMS_CMD and CMD_PTY override where the two programs are
+#
+
+DEV=$1
+BMS_CMD=${BMS_CMD:-$(dirname "$0")/bms_cmd}
+CMD_PTY=${CMD_PTY:-$(dirname "$0")/cmd_pty}
+HOST=0
+PTY_PID=
+PTY_NAME=$(mktemp)
+
+CHECKS=0
+FAILURES=0
+
+# Starts cmd_pty with the given options and points DEV at it
+start()
+{
+    stop
+    : > "$PTY_NAME"
+    "$CMD_PTY" "$@" > "$PTY_NAME" &
+    PTY_PID=$!
+    while [ ! -s "$PTY_NAME" ]; do
+        sleep 0.1
+    done
+    DEV=$(head -1 "$PTY_NAME")
+}
+
+stop()
+{
+    if [ -n "$PTY_PID" ]; then
+        kill "$PTY_PID" 2> /dev/null
+        wait "$PTY_PID" 2> /dev/null
+        PTY_PID=
+    fi
+}
+
+trap 'stop; rm -f "$PTY_NAME"' EXIT
+
+# expect <reply> <command...>: the reply has to start with <reply>
+expect()
+{
+    want=$1
+    shift
+    got=$("$BMS_CMD" "$DEV" "$@" 2>&1)
+    CHECKS=$((CHECKS + 1))
+    case "$got" in
+    "$want"*) ;;
+    *)
+        FAILURES=$((FAILURES + 1))
+        echo "FAIL '$*': got '$got', want '$want'"
+        ;;
+    esac
+}
+
+if [ -z "$DEV" ]; then
+    HOST=1
+    start
+fi
+
+# Replies come back as frames in binary mode, on the message line in ASCII
+expect "ok" mode binary
+expect "err unknown" mode hex
+
+# Parameters
+expect "ok balance ot ht ut oc occ ov uv" params
+OV=$("$BMS_CMD" "$DEV" get ov | cut -d' ' -f3)
+UT=$("$BMS_CMD" "$DEV" get ut | cut -d' ' -f3)
+expect "ok ov $OV" get ov
+expect "ok ov $OV" set ov "$OV"
+expect "ok ov $OV" "  get   ov"
+expect "err range" set ov 4301
+expect "err range" set ov 3599
+expect "err bad value" set ov 42x0
+expect "err bad value" set ov
+expect "err bad value" set ov -
+expect "err bad value" set ov 99999999
+expect "err no param" get nope
+expect "err no param" set nope 1
+expect "err no param" get
+expect "ok ut -5" set ut -5
+expect "ok ut $UT" set ut "$UT"
+
+# The parser itself
+expect "err unknown" bogus
+expect "err unknown" GET ov
+expect "err too long" get ovxxxxxxxxxxxxxxxxxxxxx
+expect "ok ov $OV" get ov
+
+# Subscriptions, smallest to largest period then the budget
+expect "err no channel" sub nope 50
+expect "err bad value" sub status
+expect "err bad value" sub status -1
+expect "err period" sub status 9
+expect "ok load" sub status 10
+expect "ok load" sub status 32767
+expect "err period" sub status 32768
+expect "err period" sub status 60000
+expect "ok load" sub status 10
+expect "ok load" sub cells 10
+expect "ok load" sub loop 10
+expect "ok load" sub temps 10
+expect "ok load" sub sop 10
+expect "err budget" sub minmax 10
+for ch in cells loop temps sop; do
+    expect "ok load" sub "$ch" 0
+done
+expect "ok load" sub status 50
+
+# The rest of the verbs
+expect "ok" stream off
+expect "ok" stream on
+expect "err unknown" stream maybe
+expect "ok" snap
+expect "ok" key
+expect "ok" trace
+expect "ok" reset
+expect "err bad value" cap 0
+expect "err bad value" cap lots
+expect "ok" cap 1000
+expect "err busy" cap 1000
+expect "ok" cap off
+expect "ok" cap now
+expect "ok" cap off
+
+# ASCII mode, then back
+expect "ok" mode ascii
+expect "ok ov $OV" get ov
+expect "err unknown" bogus
+expect "err mode" cap 1000
+expect "ok" snap
+expect "ok" trace
+expect "ok" mode binary
+expect "ok ov $OV" get ov
+
+if [ "$HOST" -eq 1 ]; then
+    # cal saves the sensor's zero, only with the contactors open and no current
+    expect "err contactor closed" cal
+    start -o -c 800
+    expect "err current flowing" cal
+    start -o -c -800
+    expect "err current flowing" cal
+    start -o -b
+    expect "err offset" cal
+    start -o -c 300
+    expect "ok" cal
+    expect "ok" cap 1000
+    expect "err capture" cal
+    expect "ok" cap off
+    expect "ok" cal
+
+    # 1000 bytes take 60mS, so a 40mS pass fills the ring. If the CR is lost
+    # too nothing answers until the next line end, which gets the error
+    start -p 40
+    got=$("$BMS_CMD" "$DEV" "get ov$(printf '%1000s' | tr ' ' x)" 2>&1)
+    if [ "$got" = "no reply" ]; then
+        expect "err overflow" get ov
+    elif [ "$got" != "err overflow" ]; then
+        CHECKS=$((CHECKS + 1))
+        FAILURES=$((FAILURES + 1))
+        echo "FAIL 1000 byte line: got '$got', want 'err overflow'"
+    fi
+    expect "ok ov" get ov
+fi
+
+echo "$CHECKS checks, $FAILURES failures"
+[ "$FAILURES" -eq 0 ]
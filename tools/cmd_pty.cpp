@@ -0,0 +1,191 @@
+/*
+ * File:   cmd_pty.cpp
+ * Author: trm84
+ *
+ * Created on October 21, 2026, 9:30 AM
+ *
+ * Host build of the command interface served on a pty, so the parser can
+ * be driven by bms_cmd (and tools/cmd_check.sh) without a board. command.c,
+ * uart.c, telemetry.c, console.c, fault.c, sop.c, trace.c and what they
+ * pull in are built as they are (long narrowed to the PIC's 32 bits, char
+ * unsigned as XC8 has it) against host/xc.h.
+ *
+ * A SIGALRM timer stands in for the UART interrupt: for every byte time
+ * (60uS, the 166667 baud rate of the board) it moves one received byte
+ * through UART_RX_TICK() and sends one queued byte through UART_TX_TICK(). The main loop
+ * runs one pass every -p mS: commandService(), the requests it returns, and
+ * the telemetry channels, the way main.c runs them. A long pass lets the RX
+ * ring fill as it would behind a slow pass on the board.
+ *
+ * The hardware the commands reach is stubbed: the contactors are open with
+ * -o, the measured current is -c mA, -b makes the current sensor's offset
+ * out of range so calibration fails, and a burst capture stays armed until
+ * "cap off".
+ *
+ * Prints the pty's name on the first line, then serves it until killed.
+ *
+ * Build: g++ -std=c++17 -O2 -funsigned-char -Ihost -o cmd_pty cmd_pty.cpp
+ * Use:   cmd_pty [-o] [-c mA] [-b] [-p mS]
+ */
+
+#include <cmath>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <sys/time.h>
+#include <termios.h>
+#include <unistd.h>
+
+#define long int // The PIC's long is 32 bits
+#include "../format.c"
+#include "../uart.c"
+#include "../delta.c"
+#include "../coulomb.c"
+#include "../sop.c"
+#include "../sensor.c"
+#include "../fault.c"
+#include "../console.c"
+#include "../telemetry.c"
+#include "../trace.c"
+#include "../command.c"
+#undef long
+
+namespace {
+
+const int kTickUs = 60;             // One byte each way, 10 bits at 166667 baud
+
+int pty = -1;
+bool badOffset = false;
+bool captureArmed = false;
+struct timespec started;
+
+// The UART interrupt: a byte each way for every byte time since the last
+// tick, the timer signal can come late
+void uartIsr(int)
+{
+    static struct timespec last = started;
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    long long due = ((now.tv_sec - last.tv_sec) * 1000000000LL + now.tv_nsec - last.tv_nsec) / (kTickUs * 1000);
+    last.tv_nsec += due * kTickUs * 1000;
+    last.tv_sec += last.tv_nsec / 1000000000;
+    last.tv_nsec %= 1000000000;
+    for (; due > 0; due--) {
+        unsigned char c;
+        if (read(pty, &c, 1) == 1) {
+            RCREG = c;
+            UART_RX_TICK();
+        }
+        if (PIE1bits.TXIE)
+            UART_TX_TICK();
+    }
+}
+
+} // namespace
+
+// Bytes the firmware puts in TXREG, from the ISR or polled. With nothing
+// reading the other end they are lost, as on an unplugged cable
+void hostTransmit(unsigned char c)
+{
+    ssize_t sent = write(pty, &c, 1);
+    (void)sent;
+}
+
+// Firmware that reaches hardware, stubbed
+int balanceThreshold = 50;
+
+unsigned int getMillis()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<unsigned int>((now.tv_sec - started.tv_sec) * 1000 + (now.tv_nsec - started.tv_nsec) / 1000000);
+}
+
+char calibrateCurrent()
+{
+    return badOffset ? 0 : 1;
+}
+
+char captureArm(int, unsigned int)
+{
+    if (captureArmed)
+        return 0;
+    captureArmed = true;
+    return 1;
+}
+
+char captureBusy()
+{
+    return captureArmed;
+}
+
+void captureStop()
+{
+    captureArmed = false;
+}
+
+int main(int argc, char **argv)
+{
+    bool contactorsOpen = false;
+    int current = 0;
+    unsigned int pass = 10;
+    int opt;
+    while ((opt = getopt(argc, argv, "oc:bp:")) != -1) {
+        switch (opt) {
+        case 'o': contactorsOpen = true; break;
+        case 'c': current = std::atoi(optarg); break;
+        case 'b': badOffset = true; break;
+        case 'p': pass = std::atoi(optarg); break;
+        default:
+            std::fprintf(stderr, "use: cmd_pty [-o] [-c mA] [-b] [-p mS]\n");
+            return 2;
+        }
+    }
+
+    pty = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (pty < 0 || grantpt(pty) != 0 || unlockpt(pty) != 0) {
+        std::perror("pty");
+        return 2;
+    }
+    struct termios tio;
+    tcgetattr(pty, &tio);
+    cfmakeraw(&tio);
+    tcsetattr(pty, TCSANOW, &tio);
+    std::printf("%s\n", ptsname(pty));
+    std::fflush(stdout);
+
+    clock_gettime(CLOCK_MONOTONIC, &started);
+    uartSetup();
+    PIR1bits.TXIF = 1;          // The hardware sets it again at once, TXREG is empty
+    faultInit();
+    traceInit();
+
+    struct sigaction isr = {};
+    isr.sa_handler = uartIsr;
+    isr.sa_flags = SA_RESTART;
+    sigaction(SIGALRM, &isr, nullptr);
+    struct itimerval tick = {{0, kTickUs}, {0, kTickUs}};
+    setitimer(ITIMER_REAL, &tick, nullptr);
+
+    // Readings for the channels, a rested pack
+    unsigned int codes[12];
+    for (unsigned int &code : codes)
+        code = 37000;
+    int temps[5] = {25, 25, 26, 25, 25};
+
+    for (;;) {
+        unsigned int start = getMillis();
+        traceRecord(getMillis(), 37000, 37000, current, 26, faultActive(), 0);
+        unsigned char requests = commandService(current, contactorsOpen);
+        if (telemetryMode() == TLM_BINARY) {
+            telemetryService(getMillis(), codes, 37000, 37000, current, temps, 5000, 5000, faultActive(), 0, 0);
+            if (requests & CMD_SNAPSHOT)
+                telemetryStatus(codes, current, temps, 5000, 5000, faultActive(), 0, 0);
+        }
+        while (getMillis() - start < pass)
+            pause();            // The ISR keeps running
+    }
+}
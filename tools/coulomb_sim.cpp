@@ -0,0 +1,134 @@
+/*
+ * File:   coulomb_sim.cpp
+ * Author: trm84
+ *
+ * Created on October 20, 2026, 8:10 AM
+ *
+ * Pack simulator drift test for coulomb.c. Builds the firmware source as is
+ * (long narrowed to the PIC's 32 bits) and drives it the way main.c does:
+ * one current sample per loop pass, counted against the whole mS elapsed on
+ * getMillis() since the previous pass. The loop period jitters, as it does
+ * when the UART and the slow tasks land on a pass.
+ *
+ * The pack runs 8 hours of discharge, rest and charge with load steps and
+ * ripple. Two things are checked against the simulated truth:
+ *  - the counter against the exact sum of the samples it was given, which
+ *    is the arithmetic alone and may not lose a single mA*mS, and
+ *  - the counter against the true continuous charge, which is what the SOC
+ *    is worth and has to stay inside one SOC step (0.01%).
+ * The old fixed interval update from before the counter (current/500 per
+ * averaged window) is run over the same passes for comparison.
+ *
+ * Build: g++ -std=c++17 -O2 -o coulomb_sim coulomb_sim.cpp
+ * Use:   coulomb_sim [seed]
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+#define long int // The PIC's long is 32 bits
+#include "../coulomb.c"
+#undef long
+
+namespace {
+
+const int kCapacity = 12;                       // Ahr, CAPACITY in main.c
+const int32_t kCapacityCharge = kCapacity * 3600000;   // mA*s
+const double kHours = 8.0;
+const int kStartSoc = 8000;                     // 0.01%
+const int kWindow = 20;                         // Samples per averaged window in the old code
+
+// One cycle is 1h of discharge, 15min rest, 1h of charge and 15min rest
+double packCurrent(double seconds)
+{
+    double t = std::fmod(seconds, 9000.0);
+    double ripple = 150.0 * std::sin(seconds * 2.0 * M_PI / 7.3);
+    if (t < 3600.0) {
+        double step = std::fmod(seconds, 120.0) < 30.0 ? 6000.0 : 0.0;   // Load steps
+        return 3500.0 + step + ripple;
+    }
+    if (t < 4500.0)
+        return 0.0;
+    if (t < 8100.0)
+        return -4000.0 - 0.5 * ripple;
+    return 0.0;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::mt19937 rng(argc > 1 ? std::atoi(argv[1]) : 1);
+    std::uniform_int_distribution<int> pass(6000, 14000);   // uS per loop pass
+    std::uniform_int_distribution<int> slow(0, 99);
+    std::normal_distribution<double> noise(0.0, 20.0);      // mA of ADC noise
+
+    coulombInit(kCapacityCharge, kStartSoc);
+
+    const double start = static_cast<double>(kStartSoc) * kCapacityCharge / SOC_FULL;
+    double truth = start * 1000.0;  // mA*mS from the continuous current
+    int64_t sampled = static_cast<int64_t>(start) * 1000;  // mA*mS from exactly the samples the counter saw
+    double oldSoc = kStartSoc / (double)SOC_FULL;   // The float update the counter replaced, 0-1
+    double oldWindow = 0.0;
+    int oldCount = 0;
+
+    int64_t nowUs = 0;
+    uint32_t lastSample = 0;
+    int64_t worstArithmetic = 0;
+    double worstTruth = 0.0;
+    long passes = 0;
+
+    const double step = 0.0005;     // S, integration step for the truth
+    double truthTime = 0.0;
+    while (nowUs < static_cast<int64_t>(kHours * 3600e6)) {
+        int32_t dtUs = pass(rng);
+        if (slow(rng) == 0)
+            dtUs += 40000;          // A pass that also ran the slow tasks
+        nowUs += dtUs;
+
+        double seconds = nowUs / 1e6;
+        for (; truthTime + step <= seconds; truthTime += step)
+            truth -= packCurrent(truthTime + step / 2) * step * 1000.0;
+        truth -= packCurrent((truthTime + seconds) / 2) * (seconds - truthTime) * 1000.0;
+        truthTime = seconds;
+
+        // As main.c: one sample per pass against the whole mS since the last
+        uint32_t now = static_cast<uint32_t>(nowUs / 1000);
+        int32_t current = static_cast<int32_t>(std::lround(packCurrent(seconds) + noise(rng)));
+        coulombUpdate(current, now - lastSample);
+        sampled -= static_cast<int64_t>(current) * (now - lastSample);
+        lastSample = now;
+        passes++;
+
+        oldWindow += current;
+        if (++oldCount == kWindow) {
+            double amps = oldWindow / kWindow / 1000.0;
+            oldSoc = ((oldSoc * kCapacity * 3600.0) - (amps / 500)) / (kCapacity * 3600.0);
+            oldWindow = 0.0;
+            oldCount = 0;
+        }
+
+        int64_t held = static_cast<int64_t>(coulombCharge()) * 1000 + chargeRemainder;
+        worstArithmetic = std::max<int64_t>(worstArithmetic, std::llabs(held - sampled));
+        double counted = coulombCharge();
+        worstTruth = std::fmax(worstTruth, std::fabs(counted - truth / 1000.0));
+    }
+
+    const double socStep = kCapacityCharge / (double)SOC_FULL;
+    double counted = coulombCharge();
+    std::printf("%ld passes over %.1f hours\n", passes, kHours);
+    std::printf("%-32s %12.0f mA*s\n", "true charge", truth / 1000.0);
+    std::printf("%-32s %12.0f mA*s\n", "counter", counted);
+    std::printf("%-32s %12lld mA*mS\n", "worst error vs the samples", static_cast<long long>(worstArithmetic));
+    std::printf("%-32s %12.1f mA*s  (%.4f%% SOC)\n", "worst error vs the truth", worstTruth, worstTruth / socStep / 100.0);
+    std::printf("%-32s %12.2f%%   counter %.2f%%  truth %.2f%%\n", "old fixed interval SOC",
+                oldSoc * 100.0, coulombSoc() / 100.0, truth / 1000.0 / kCapacityCharge * 100.0);
+
+    bool ok = worstArithmetic == 0 && worstTruth < socStep;
+    std::printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
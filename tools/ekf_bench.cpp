@@ -0,0 +1,274 @@
+/*
+ * File:   ekf_bench.cpp
+ * Author: trm84
+ *
+ * Created on October 20, 2026, 9:30 AM
+ *
+ * Host harness for ekf.c. Builds the firmware source as is (long narrowed
+ * to the PIC's 32 bits) and runs it once a second against a simulated pack
+ * on a repeating drive cycle, fed the way main.c feeds it: the charge moved
+ * on the coulomb counter, the current and the average cell voltage. The
+ * simulated cell has its own R0, R1 and tau, a little off from ekf.h, the
+ * current sensor reads 80mA high and the cell voltage carries 2mV of noise.
+ * Both estimators start 20% SOC off. The error of the EKF and of the
+ * coulomb counter alone is reported against the true SOC. The EKF has to
+ * be within 2% for good by kConvergeBy: with the model's R0 and R1 10% off
+ * the simulated cell's, each long pull drags it 3-6% low until about 40
+ * minutes in, where the table gets steep enough to hold it.
+ *
+ * The PIC can't be timed here, so the same sources are built a second time
+ * with every long replaced by a counting type. That gives the long
+ * multiplies, divides, shifts and adds of each update, and so the cycles
+ * per update under the cost figures ekf.h budgets with. The counting build
+ * also checks every long operation for signed overflow and must give the
+ * same SOC as the plain build. The result is an estimate to size the
+ * budget with, the figure that counts is ekfCycles, the worst update
+ * Timer1 has timed on the board, on the console's EKF cycles field.
+ *
+ * Build: g++ -std=c++17 -O2 -o ekf_bench ekf_bench.cpp
+ * Use:   ekf_bench [seed]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+#define long int // The PIC's long is 32 bits
+#include "../coulomb.c"
+#include "../ocv.c"
+#include "../ekf.c"
+#undef long
+
+namespace {
+
+// Tally of the 32 bit operations done by the counting build
+struct Tally {
+    long multiplies = 0;
+    long divides = 0;
+    long shiftBits = 0;
+    long adds = 0;
+    long overflows = 0;
+};
+
+Tally tally;
+
+// Stands in for the PIC's 32 bit long: wraps like it, counts every operation
+// and flags any result a signed long can't hold
+class Counted {
+public:
+    Counted(int64_t v = 0) : value(check(v)) {}
+    explicit operator int() const { return value; }
+    explicit operator char() const { return static_cast<char>(value); }
+
+    friend Counted operator+(Counted a, Counted b) { tally.adds++; return Counted(int64_t(a.value) + b.value); }
+    friend Counted operator-(Counted a, Counted b) { tally.adds++; return Counted(int64_t(a.value) - b.value); }
+    friend Counted operator*(Counted a, Counted b) { tally.multiplies++; return Counted(int64_t(a.value) * b.value); }
+    friend Counted operator/(Counted a, Counted b) { tally.divides++; return Counted(a.value / b.value); }
+    friend Counted operator%(Counted a, Counted b) { tally.divides++; return Counted(a.value % b.value); }
+    friend Counted operator<<(Counted a, int n) { tally.shiftBits += n; return Counted(int64_t(a.value) * (int64_t(1) << n)); }
+    friend Counted operator>>(Counted a, int n) { tally.shiftBits += n; return Counted(a.value >> n); }
+    Counted operator-() const { tally.adds++; return Counted(-int64_t(value)); }
+    Counted &operator+=(Counted b) { return *this = *this + b; }
+    Counted &operator-=(Counted b) { return *this = *this - b; }
+
+    friend bool operator<(Counted a, Counted b) { tally.adds++; return a.value < b.value; }
+    friend bool operator>(Counted a, Counted b) { tally.adds++; return a.value > b.value; }
+    friend bool operator<=(Counted a, Counted b) { tally.adds++; return a.value <= b.value; }
+    friend bool operator>=(Counted a, Counted b) { tally.adds++; return a.value >= b.value; }
+
+private:
+    static int32_t check(int64_t v)
+    {
+        if (v > INT32_MAX || v < INT32_MIN)
+            tally.overflows++;
+        return static_cast<int32_t>(v);
+    }
+
+    int32_t value;
+};
+
+} // namespace
+
+// The counting build. The headers are already in, so only the code comes
+// in again; unsigned is dropped because the counting type is signed (every
+// unsigned long here holds a small dt or time)
+namespace counted {
+#define long Counted
+#define unsigned
+#include "../ocv.c"
+#include "../ekf.c"
+#undef unsigned
+#undef long
+} // namespace counted
+
+namespace {
+
+// Cycle costs of the XC8 -O0 long routines, as budgeted in ekf.h
+const long kMultiplyCycles = 350;
+const long kDivideCycles = 1100;
+const long kShiftBitCycles = 6;     // Four rotates and the loop per bit
+const long kAddCycles = 8;          // Add, subtract or compare, byte by byte
+
+const int kCapacity = 12;           // Ahr, CAPACITY in main.c
+const int32_t kCapacityCharge = kCapacity * 3600000;   // mA*s
+const int kSamplePeriod = 10;       // mS, one current sample per loop pass
+const int kUpdatePeriod = 1000;     // mS, UART_PERIOD
+const double kTrueSoc = 0.90;
+const double kStartSoc = 0.70;      // Where both estimators start
+const double kR0 = 11.0;            // mOhm, the simulated cell
+const double kR1 = 9.0;             // mOhm
+const double kTau = 25.0;           // S
+const double kSensorOffset = 80.0;  // mA the current sensor reads high
+const double kVoltageNoise = 2.0;   // mV
+const double kConverged = 2.0;      // % SOC
+const double kConvergeBy = 45.0;    // Minutes to be within kConverged for good
+
+// One 10 minute drive: pull away, cruise, brake with regen, sit at lights
+double driveCurrent(double seconds)
+{
+    double t = std::fmod(seconds, 600.0);
+    if (t < 15.0) return 40000.0;
+    if (t < 120.0) return 15000.0 + 3000.0 * std::sin(t / 7.0);
+    if (t < 130.0) return -20000.0;
+    if (t < 160.0) return 0.0;
+    if (t < 175.0) return 35000.0;
+    if (t < 400.0) return 22000.0 + 4000.0 * std::sin(t / 11.0);
+    if (t < 415.0) return -25000.0;
+    if (t < 480.0) return 8000.0;
+    if (t < 490.0) return -15000.0;
+    return 0.0;
+}
+
+// Resting cell voltage (mV) for a SOC (0-1), between the same table points
+double trueOcv(double soc)
+{
+    double x = std::clamp(soc, 0.0, 1.0) * (OCV_POINTS - 1);
+    int i = std::min(static_cast<int>(x), OCV_POINTS - 2);
+    return ocvTable[i] + (x - i) * (ocvTable[i + 1] - static_cast<double>(ocvTable[i]));
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::mt19937 rng(argc > 1 ? std::atoi(argv[1]) : 1);
+    std::normal_distribution<double> voltageNoise(0.0, kVoltageNoise);
+
+    int start = static_cast<int>(kStartSoc * SOC_FULL);
+    coulombInit(kCapacityCharge, start);
+    ekfInit(kCapacityCharge, start);
+    counted::ekfInit(kCapacityCharge, start);
+
+    double soc = kTrueSoc;          // Truth, 0-1
+    double v1 = 0.0;                // mV across the RC pair
+    int32_t lastCharge = coulombCharge();
+    double windowCurrent = 0.0;
+    int windowSamples = 0;
+
+    long updates = 0;
+    long mismatches = 0;
+    double convergedAt = -1.0;
+    double sumSquares = 0.0;
+    long settled = 0;
+    double worstCoulomb = 0.0;
+    long worstCycles = 0;
+    long fewestCycles = 0;
+    Tally worstTally;
+    double hostNs = 0.0;
+
+    double seconds = 0.0;
+    while (soc > 0.10 && seconds < 4 * 3600.0) {
+        for (int pass = 0; pass < kUpdatePeriod / kSamplePeriod; pass++) {
+            double current = driveCurrent(seconds);   // mA, discharge positive
+            double dt = kSamplePeriod / 1000.0;
+            soc -= current * dt / 1000.0 / 3600.0 / kCapacity;
+            double decay = std::exp(-dt / kTau);
+            v1 = v1 * decay + (1.0 - decay) * kR1 * current / 1000.0;
+            seconds += dt;
+
+            int32_t measured = static_cast<int32_t>(std::lround(current + kSensorOffset));
+            coulombUpdate(measured, kSamplePeriod);
+            windowCurrent += measured;
+            windowSamples++;
+        }
+
+        double cell = trueOcv(soc) - v1 - kR0 * driveCurrent(seconds) / 1000.0 + voltageNoise(rng);
+        int32_t current = static_cast<int32_t>(std::lround(windowCurrent / windowSamples));
+        unsigned int cellVoltage = static_cast<unsigned int>(std::lround(cell * 10.0));   // 0.1mV
+        int32_t deltaCharge = coulombCharge() - lastCharge;
+        lastCharge = coulombCharge();
+        windowCurrent = 0.0;
+        windowSamples = 0;
+
+        auto begin = std::chrono::steady_clock::now();
+        ekfUpdate(deltaCharge, current, cellVoltage, kUpdatePeriod);
+        hostNs += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count();
+
+        Tally before = tally;
+        counted::ekfUpdate(deltaCharge, current, cellVoltage, kUpdatePeriod);
+        Tally used;
+        used.multiplies = tally.multiplies - before.multiplies;
+        used.divides = tally.divides - before.divides;
+        used.shiftBits = tally.shiftBits - before.shiftBits;
+        used.adds = tally.adds - before.adds;
+        long cycles = used.multiplies * kMultiplyCycles + used.divides * kDivideCycles +
+                      used.shiftBits * kShiftBitCycles + used.adds * kAddCycles;
+        if (cycles > worstCycles) {
+            worstCycles = cycles;
+            worstTally = used;
+        }
+        if (fewestCycles == 0 || cycles < fewestCycles)
+            fewestCycles = cycles;
+        if (counted::ekfSoc() != ekfSoc())
+            mismatches++;
+        updates++;
+
+        double ekfError = ekfSoc() / 100.0 - soc * 100.0;
+        double coulombError = coulombSoc() / 100.0 - soc * 100.0;
+        if (std::fabs(ekfError) > kConverged) {
+            convergedAt = -1.0;     // Only counts once it stays in
+            sumSquares = 0.0;
+            settled = 0;
+        }
+        else if (convergedAt < 0.0)
+            convergedAt = seconds;
+        if (convergedAt >= 0.0) {
+            sumSquares += ekfError * ekfError;
+            settled++;
+        }
+        worstCoulomb = std::fmax(worstCoulomb, std::fabs(coulombError));
+    }
+
+    std::printf("%ld updates over %.0f minutes of driving, true SOC %.0f%% to %.1f%%\n",
+                updates, seconds / 60.0, kTrueSoc * 100.0, soc * 100.0);
+    std::printf("both estimators started at %.0f%%\n\n", kStartSoc * 100.0);
+
+    std::printf("%-34s %10s\n", "", "SOC error");
+    if (convergedAt < 0.0) {
+        std::printf("%-34s %10s\n", "EKF within 2%", "never");
+    } else {
+        std::printf("%-34s %8.1f min (limit %.0f)\n", "EKF within 2% from", convergedAt / 60.0, kConvergeBy);
+        std::printf("%-34s %9.2f%%\n", "EKF RMS after that", std::sqrt(sumSquares / settled));
+    }
+    std::printf("%-34s %9.2f%%\n", "EKF at the end", ekfSoc() / 100.0 - soc * 100.0);
+    std::printf("%-34s %9.2f%%\n", "coulomb counter worst", worstCoulomb);
+    std::printf("%-34s %9.2f%%\n\n", "coulomb counter at the end", coulombSoc() / 100.0 - soc * 100.0);
+
+    std::printf("per update: %ld multiplies, %ld divides, %ld shift bits, %ld adds/compares\n",
+                worstTally.multiplies, worstTally.divides, worstTally.shiftBits, worstTally.adds);
+    std::printf("%-34s %6ld - %ld cycles (budget %d)\n", "estimated PIC cycles per update",
+                fewestCycles, worstCycles, EKF_MAX_CYCLES);
+    std::printf("%-34s %8.1f uS at 8MIPS\n", "worst case", worstCycles / 8.0);
+    std::printf("%-34s %8.1f nS\n", "host time per update", hostNs / updates);
+    std::printf("%-34s %8ld\n", "long overflows", tally.overflows);
+    std::printf("%-34s %8ld\n", "counting build mismatches", mismatches);
+
+    bool ok = convergedAt >= 0.0 && convergedAt <= kConvergeBy * 60.0 && worstCycles <= EKF_MAX_CYCLES &&
+              tally.overflows == 0 && mismatches == 0;
+    std::printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,300 @@
+/*
+ * File:   format_bench.cpp
+ * Author: trm84
+ *
+ * Created on October 20, 2026, 12:40 AM
+ *
+ * Host check and benchmark for format.c. Builds the firmware source as is
+ * (long narrowed to the PIC's 32 bits), compares every routine against the
+ * printf conversion it replaces over edge cases and random values, then
+ * times both. The host has a hardware divider, so printf's divide per digit
+ * is cheap here; on the PIC each one is a software 32 bit divide, which is
+ * what the subtraction loop avoids.
+ *
+ * For the PIC it prints two more tables, both from the last build that
+ * still had sprintf in it (dist/default/production, XC8 v1.45):
+ *  - Flash: the words of _sprintf and of every library routine only it
+ *    called, off the .map. All of it goes once nothing calls sprintf;
+ *    format.c's own words have to come off the map of the next XC8 build.
+ *  - Cycles per number: doprnt's digit loop does val / dpowers[c] % 10, a
+ *    ___lldiv and a ___llmod a digit. lldivCycles() and llmodCycles() walk
+ *    the two routines instruction by instruction as the .lst has them, with
+ *    the 134 cycles around the calls, so that side is what the simulator's
+ *    stopwatch would give for the digit loop (its format string parsing and
+ *    digit count are left out). There is no listing of format.c here, so
+ *    formatCycles() is an estimate built from the same instruction
+ *    sequences: doprnt's table read, the library's 32 bit compare and a 32
+ *    bit subtract.
+ *
+ * Build: g++ -std=c++17 -O2 -o format_bench format_bench.cpp
+ * Use:   format_bench
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#define long int // The PIC's long is 32 bits
+#include "../format.c"
+#undef long
+
+namespace {
+
+const int kIterations = 1000000;
+int failures = 0;
+const double kMips = 8.0;       // FOSC 32MHz / 4
+
+// _sprintf and what only it called in the sprintf build, words off the .map
+struct Routine {
+    const char *name;
+    int words;
+};
+const Routine kSprintfOnly[] = {
+    {"_sprintf", 1835 + 339},   // text8 and text8_split_1
+    {"_scale", 656},
+    {"_fround", 470},
+    {"__div_to_l_", 197},
+    {"__tdiv_to_l_", 182},
+    {"___lldiv", 83},
+    {"___awdiv", 82},
+    {"___awmod", 70},
+    {"___llmod", 67},
+    {"___flsub", 31},
+    {"_isdigit", 14},
+};
+const int kProgramWords = 16384;
+const int kSprintfBuildUsed = 13258;    // memoryfile.xml of that build
+
+// The library's 32 bit compare (___lldiv at 0x29BA): a byte at a time from
+// the top until two differ, then skipc on the borrow. Cycles up to and
+// including the branch on a >= b
+int compareCycles(uint32_t a, uint32_t b)
+{
+    int cycles = 0;
+    for (int k = 3; k > 0; k--) {
+        if (((a >> (8 * k)) & 0xFF) != ((b >> (8 * k)) & 0xFF))
+            return cycles + 5 + (a >= b ? 2 : 3);   // movf, subwf, skipz, goto
+        cycles += 4;
+    }
+    return cycles + 2 + (a >= b ? 2 : 3);
+}
+
+// ___lldiv (0x2994), fcall and return included. Divisor not 0
+int lldivCycles(uint32_t divisor, uint32_t dividend, uint32_t *quotient)
+{
+    int cycles = 4 + 17;
+    int counter = 1;
+    while (!(divisor & 0x80000000u)) {  // Normalise, 15 a shift
+        divisor <<= 1;
+        counter++;
+        cycles += 15;
+    }
+    cycles += 3;
+    uint32_t q = 0;
+    do {
+        q <<= 1;
+        cycles += 7 + compareCycles(dividend, divisor);
+        if (dividend >= divisor) {
+            dividend -= divisor;
+            q |= 1;
+            cycles += 9;
+        }
+        divisor >>= 1;
+        counter--;
+        cycles += 7 + 2 + (counter != 0 ? 3 : 2);
+    } while (counter != 0);
+    *quotient = q;
+    return cycles + 10;
+}
+
+// ___llmod (0x2867), the same loop without the quotient
+int llmodCycles(uint32_t divisor, uint32_t dividend, uint32_t *remainder)
+{
+    int cycles = 4 + 9;
+    int counter = 1;
+    while (!(divisor & 0x80000000u)) {
+        divisor <<= 1;
+        counter++;
+        cycles += 15;
+    }
+    cycles += 3;
+    do {
+        cycles += compareCycles(dividend, divisor);
+        if (dividend >= divisor) {
+            dividend -= divisor;
+            cycles += 8;
+        }
+        divisor >>= 1;
+        counter--;
+        cycles += 7 + 2 + (counter != 0 ? 3 : 2);
+    } while (counter != 0);
+    *remainder = dividend;
+    return cycles + 10;
+}
+
+// doprnt's digit loop for an unsigned value: the divides plus 134 cycles of
+// argument moves, digit store and loop test a digit (0x0542 to 0x05C4)
+int sprintfCycles(uint32_t value)
+{
+    static const uint32_t dpowers[] = {1, 10, 100, 1000, 10000, 100000, 1000000,
+                                       10000000, 100000000, 1000000000};
+    int digits = 1;
+    while (digits < 10 && value >= dpowers[digits])
+        digits++;
+    int cycles = 0;
+    while (digits-- > 0) {
+        uint32_t q;
+        uint32_t digit;
+        cycles += 134 + lldivCycles(dpowers[digits], value, &q);
+        cycles += llmodCycles(10, q, &digit);
+        if (digit != value / dpowers[digits] % 10)
+            failures++;
+    }
+    return cycles;
+}
+
+// formatUnsigned() as XC8 would build it, an estimate: every test and
+// subtraction reads formatPowers[p] again (23 cycles, doprnt's read of
+// dpowers), the subtract is 8 with the digit++ and branch back 3, and the
+// started test, store and loop test of a place about 20
+int formatCycles(uint32_t value)
+{
+    const int kRead = 23;
+    const int kPlace = 20;
+    int cycles = 0;
+    for (uint32_t power : formatPowers) {
+        cycles += kPlace + kRead + compareCycles(value, power);
+        while (value >= power) {
+            value -= power;
+            cycles += kRead + 11 + kRead + compareCycles(value, power);
+        }
+    }
+    return cycles;
+}
+
+// The sprintf version of formatFixed: sign on its own, then whole.fraction
+std::string printfFixed(int32_t value, int decimals)
+{
+    static const int32_t scales[] = {1, 10, 100, 1000, 10000};
+    char buf[32];
+    uint32_t u = value < 0 ? 0u - static_cast<uint32_t>(value) : value;
+    if (decimals == 0)
+        std::snprintf(buf, sizeof(buf), "%s%u", value < 0 ? "-" : "", u);
+    else
+        std::snprintf(buf, sizeof(buf), "%s%u.%0*u", value < 0 ? "-" : "",
+                      u / scales[decimals], decimals, u % scales[decimals]);
+    return buf;
+}
+
+void expect(const std::string &got, const std::string &want, const char *what)
+{
+    if (got != want && failures++ < 10)
+        std::printf("FAIL %s: got '%s' want '%s'\n", what, got.c_str(), want.c_str());
+}
+
+void check(int32_t value)
+{
+    char out[32];
+    char want[32];
+    for (int d = 0; d <= 4; d++) {
+        expect(std::string(out, formatFixed(out, value, d)), printfFixed(value, d), "formatFixed");
+        std::snprintf(want, sizeof(want), "%*s", 8, printfFixed(value, d).c_str());
+        expect(std::string(out, formatPadded(out, value, d, 8)), want, "formatPadded");
+    }
+    std::snprintf(want, sizeof(want), "%d", value);
+    expect(std::string(out, formatSigned(out, value)), want, "formatSigned");
+    std::snprintf(want, sizeof(want), "%u", static_cast<uint32_t>(value));
+    expect(std::string(out, formatUnsigned(out, static_cast<uint32_t>(value))), want, "formatUnsigned");
+    std::snprintf(want, sizeof(want), "%08X", static_cast<uint32_t>(value));
+    expect(std::string(out, formatHex(out, static_cast<uint32_t>(value), 8)), want, "formatHex");
+}
+
+template <typename F>
+double nsPerCall(const std::vector<int32_t> &values, F f)
+{
+    volatile char sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kIterations; i++)
+        sink = sink + f(values[i % values.size()]);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / kIterations;
+}
+
+} // namespace
+
+int main()
+{
+    std::mt19937 rng(1);
+    std::vector<int32_t> values = {0, 1, -1, 9, 10, -10, 99999, 100000, 37012, -500,
+                                   INT32_MAX, INT32_MIN, INT32_MIN + 1};
+    for (int i = 0; i < 100000; i++)
+        values.push_back(static_cast<int32_t>(rng()) >> (rng() % 32));
+    for (int32_t v : values)
+        check(v);
+    std::printf("%zu values checked, %d failures\n", values.size(), failures);
+
+    // Typical dashboard values: cell codes, currents, temperatures
+    std::vector<int32_t> typical;
+    for (int i = 0; i < 4096; i++)
+        typical.push_back(static_cast<int32_t>(rng() % 60000) - 20000);
+
+    char buf[32];
+    double fixedOurs = nsPerCall(typical, [&](int32_t v) { return formatFixed(buf, v, 4); });
+    double fixedPrintf = nsPerCall(typical, [&](int32_t v) {
+        uint32_t u = v < 0 ? 0u - static_cast<uint32_t>(v) : v;
+        return std::snprintf(buf, sizeof(buf), "%s%u.%04u", v < 0 ? "-" : "", u / 10000, u % 10000);
+    });
+    double intOurs = nsPerCall(typical, [&](int32_t v) { return formatSigned(buf, v); });
+    double intPrintf = nsPerCall(typical, [&](int32_t v) { return std::snprintf(buf, sizeof(buf), "%d", v); });
+    double floatPrintf = nsPerCall(typical, [&](int32_t v) {
+        return std::snprintf(buf, sizeof(buf), "%0.4f", v / 10000.0f);
+    });
+
+    std::printf("\n%-28s %10s %10s\n", "", "format.c", "printf");
+    std::printf("%-28s %8.1fns %8.1fns\n", "fixed point, 4 decimals", fixedOurs, fixedPrintf);
+    std::printf("%-28s %8.1fns %8.1fns\n", "signed integer", intOurs, intPrintf);
+    std::printf("%-28s %10s %8.1fns  (the old %%0.4f)\n", "float", "", floatPrintf);
+
+    int freed = 0;
+    std::printf("\nFlash only sprintf used (XC8 v1.45 .map), words\n");
+    for (const Routine &r : kSprintfOnly) {
+        std::printf("  %-16s %5d\n", r.name, r.words);
+        freed += r.words;
+    }
+    std::printf("  %-16s %5d  (%.1f%% of the %d used, %d free -> %d)\n", "total", freed,
+                100.0 * freed / kSprintfBuildUsed, kSprintfBuildUsed,
+                kProgramWords - kSprintfBuildUsed, kProgramWords - kSprintfBuildUsed + freed);
+
+    // The typical values' magnitudes, signs cost both about the same
+    double oursCycles = 0;
+    double sprintfCyclesTotal = 0;
+    int worstOurs = 0;
+    int worstSprintf = 0;
+    for (int32_t v : typical) {
+        uint32_t u = v < 0 ? 0u - static_cast<uint32_t>(v) : v;
+        int ours = formatCycles(u);
+        int theirs = sprintfCycles(u);
+        oursCycles += ours;
+        sprintfCyclesTotal += theirs;
+        worstOurs = std::max(worstOurs, ours);
+        worstSprintf = std::max(worstSprintf, theirs);
+    }
+    oursCycles /= typical.size();
+    sprintfCyclesTotal /= typical.size();
+    std::printf("\nPIC cycles a number, typical values   %10s %10s\n", "format.c", "sprintf");
+    std::printf("%-36s %10.0f %10.0f  (%.1fx)\n", "mean", oursCycles, sprintfCyclesTotal,
+                sprintfCyclesTotal / oursCycles);
+    std::printf("%-36s %10d %10d\n", "worst", worstOurs, worstSprintf);
+    std::printf("%-36s %8.0fuS %8.0fuS  (at %.0f MIPS)\n", "mean time", oursCycles / kMips,
+                sprintfCyclesTotal / kMips, kMips);
+    std::printf("%-36s %10d %10d\n", "4294967295", formatCycles(UINT32_MAX), sprintfCycles(UINT32_MAX));
+    if (failures != 0)
+        std::printf("FAIL the divide model got a digit wrong\n");
+
+    return failures == 0 ? 0 : 1;
+}
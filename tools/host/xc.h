@@ -0,0 +1,58 @@
+/*
+ * File:   xc.h
+ * Author: trm84
+ *
+ * Created on October 21, 2026, 9:10 AM
+ *
+ * Stand-in for the XC8 device header in host builds of the UART side of
+ * the firmware (tools/cmd_pty.cpp). Only the registers uart.c and the
+ * UART ISR macros touch are here. They are plain variables, except TXREG:
+ * every byte written to it is handed to hostTransmit(), which the harness
+ * provides. PIR1bits.TXIF reads 1 so polled writes never wait.
+ */
+
+#ifndef HOST_XC_H
+#define HOST_XC_H
+
+#define __persistent
+
+void hostTransmit(unsigned char c);
+
+struct HostTxReg {
+    HostTxReg &operator=(unsigned char c) { hostTransmit(c); return *this; }
+};
+
+volatile struct {
+    unsigned TXIE : 1;
+    unsigned RCIE : 1;
+} PIE1bits;
+
+volatile struct {
+    unsigned TXIF : 1;
+    unsigned RCIF : 1;
+} PIR1bits = {1, 0};
+
+volatile struct {
+    unsigned TX9 : 1;
+    unsigned TXEN : 1;
+    unsigned SYNC : 1;
+    unsigned BRGH : 1;
+} TXSTAbits;
+
+volatile struct {
+    unsigned RX9 : 1;
+    unsigned SPEN : 1;
+    unsigned CREN : 1;
+    unsigned OERR : 1;
+} RCSTAbits;
+
+volatile struct {
+    unsigned TRISC7 : 1;
+} TRISCbits;
+
+volatile unsigned char SPBRGH;
+volatile unsigned char SPBRGL;
+volatile unsigned char RCREG;
+HostTxReg TXREG;
+
+#endif
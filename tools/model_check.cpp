@@ -0,0 +1,525 @@
+/*
+ * File:   model_check.cpp
+ * Author: trm84
+ *
+ * Created on October 20, 2026, 10:40 AM
+ *
+ * Host checks for the estimation and protection modules: the IR fit, state
+ * of power, state of health, the fault table, sensor plausibility and the
+ * runaway trends. Builds the firmware sources as they are (long narrowed to
+ * the PIC's 32 bits, char unsigned as XC8 has it) with the EEPROM held in
+ * an array, and drives each module through the cases it exists for. Every
+ * failed check is printed with what was expected.
+ *
+ * Build: g++ -std=c++17 -O2 -funsigned-char -o model_check model_check.cpp
+ * Use:   model_check
+ */
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#define long int // The PIC's long is 32 bits
+#include "../ir.c"
+#include "../sop.c"
+#include "../soh.c"
+#include "../fault.c"
+#include "../sensor.c"
+#include "../slope.c"
+#undef long
+
+// Data EEPROM, erased
+unsigned char eeprom[256];
+int eepromWrites = 0;
+
+unsigned char eepromRead(unsigned char addr) { return eeprom[addr]; }
+void eepromWrite(unsigned char addr, unsigned char data)
+{
+    if (eeprom[addr] != data) {
+        eeprom[addr] = data;
+        eepromWrites++;
+    }
+}
+unsigned int eepromReadWord(unsigned char addr) { return eeprom[addr] | (eeprom[addr + 1] << 8); }
+void eepromWriteWord(unsigned char addr, unsigned int data)
+{
+    eepromWrite(addr, data & 0xFF);
+    eepromWrite(addr + 1, data >> 8);
+}
+unsigned int eepromReadLong(unsigned char addr) { return eepromReadWord(addr) | (eepromReadWord(addr + 2) << 16); }
+void eepromWriteLong(unsigned char addr, unsigned int data)
+{
+    eepromWriteWord(addr, data & 0xFFFF);
+    eepromWriteWord(addr + 2, data >> 16);
+}
+
+namespace {
+
+int checks = 0;
+int failures = 0;
+
+void expect(bool ok, const char *what)
+{
+    checks++;
+    if (!ok) {
+        failures++;
+        std::printf("FAIL %s\n", what);
+    }
+}
+
+void expectNear(double got, double want, double tolerance, const char *what)
+{
+    checks++;
+    if (std::fabs(got - want) > tolerance) {
+        failures++;
+        std::printf("FAIL %s: got %.1f want %.1f\n", what, got, want);
+    }
+}
+
+void section(const char *name, int before, int failedBefore)
+{
+    std::printf("%-8s %3d checks, %d failed\n", name, checks - before, failures - failedBefore);
+}
+
+/*IR*/
+
+void irReset()
+{
+    std::memset(cellIr, 0, sizeof(cellIr));
+    prevValid = 0;
+}
+
+// Sweep with every cell at rest voltage minus its ohmic drop (uOhm * mA)
+void irSweep(const int r[], int rest, int current, unsigned int now)
+{
+    unsigned int codes[IR_CELLS];
+    for (int i = 0; i < IR_CELLS; i++)
+        codes[i] = rest - static_cast<int>(std::lround(static_cast<double>(r[i]) * current / 100000.0));
+    irUpdate(codes, current, now);
+}
+
+void checkIr()
+{
+    int before = checks, failedBefore = failures;
+    int r[IR_CELLS];
+    for (int i = 0; i < IR_CELLS; i++)
+        r[i] = 1500 + 250 * i;
+    r[7] = 9000;                    // The weak cell
+
+    irReset();
+    irSweep(r, 37000, 500, 0);
+    irSweep(r, 37000, 8500, 200);
+    expectNear(irGet(0), r[0], r[0] * 0.02, "ir: the first step seeds the estimate");
+    for (int step = 0; step < 40; step++)
+        irSweep(r, 37000, step % 2 ? 8500 : 500, 400 + 200 * step);
+    bool close = true;
+    for (int i = 0; i < IR_CELLS; i++)
+        close = close && std::fabs(static_cast<double>(irGet(i)) - r[i]) <= r[i] * 0.02 + 20;
+    expect(close, "ir: every cell settles within 2% of its resistance");
+    int cell;
+    irMax(&cell);
+    expect(cell == 7, "ir: irMax finds the weak cell");
+
+    irReset();
+    irSweep(r, 37000, 500, 0);
+    irSweep(r, 37000, 8500, 600);
+    expect(irGet(0) == 0, "ir: a step after IR_MAX_GAP is ignored");
+    irSweep(r, 37000, 8500 + IR_STEP_CURRENT - 1, 700);
+    expect(irGet(0) == 0, "ir: a step under IR_STEP_CURRENT is ignored");
+
+    irReset();
+    unsigned int codes[IR_CELLS];
+    for (int i = 0; i < IR_CELLS; i++)
+        codes[i] = 37000;
+    irUpdate(codes, 0, 0);
+    codes[3] = 0;                   // Not connected
+    codes[4] = 37000 - IR_MAX_DV - 1;   // Glitch
+    codes[5] = 37000 + 10;          // Rises on a load, reads negative
+    irUpdate(codes, 5000, 100);
+    expect(irGet(3) == 0 && irGet(4) == 0 && irGet(5) == 0, "ir: open cells, glitches and negative readings are thrown away");
+
+    section("ir", before, failedBefore);
+}
+
+/*SOP*/
+
+void sopReset()
+{
+    sopDerated = 0;
+    sopCells(0, 0);
+}
+
+// What sop.h says the limit should be, before clamping and derating
+double sopExpected(double head, double ir, int rQ8, double present)
+{
+    return present + head * 100000.0 / (ir * rQ8 / 256.0);
+}
+
+void checkSop()
+{
+    int before = checks, failedBefore = failures;
+
+    sopReset();
+    sopUpdate(0, 25, 25, 5000, 10000);
+    expect(sopDischarge(SOP_2S) == 0 && sopCharge(SOP_2S) == 0, "sop: nothing is allowed without cell data");
+
+    sopCells(30500, 41800);
+    sopUpdate(2000, 25, 25, 5000, 10000);
+    expectNear(sopDischarge(SOP_2S), sopExpected(500, 10000, SOP_R2_Q8, 2000), 2, "sop: 2S discharge from the headroom");
+    expectNear(sopDischarge(SOP_10S), sopExpected(500, 10000, SOP_R10_Q8, 2000), 2, "sop: 10S discharge from the headroom");
+    expect(sopDischarge(SOP_10S) < sopDischarge(SOP_2S), "sop: the 10S window allows less than the 2S window");
+    expect(sopCharge(SOP_2S) == 0, "sop: no charge while the load already uses the headroom");
+    sopUpdate(-1000, 25, 25, 5000, 10000);
+    expectNear(sopCharge(SOP_2S), sopExpected(200, 10000, SOP_R2_Q8, 1000), 2, "sop: 2S charge from the headroom");
+
+    sopUpdate(2000, 25, 25, 5000, 0);
+    expectNear(sopDischarge(SOP_2S), sopExpected(500, SOP_DEFAULT_IR, SOP_R2_Q8, 2000), 2, "sop: SOP_DEFAULT_IR until the IR is known");
+
+    sopCells(40000, 40000);
+    sopUpdate(0, 25, 25, 5000, 10000);
+    expect(sopDischarge(SOP_2S) == SOP_MAX_DISCHARGE && sopCharge(SOP_2S) == SOP_MAX_CHARGE, "sop: limits are clamped to the pack maximum");
+    sopUpdate(0, 25, 25, 5000, 65535);
+    expect(sopDischarge(SOP_2S) > 0, "sop: the largest IR still gives a limit");
+
+    sopCells(29000, 43000);
+    sopUpdate(0, 25, 25, 5000, 10000);
+    expect(sopDischarge(SOP_2S) == 0 && sopCharge(SOP_2S) == 0, "sop: past the cell limits nothing is allowed, never negative");
+
+    sopCells(40000, 40000);
+    sopUpdate(0, 25, (SOP_TEMP_WARM + SOP_TEMP_HIGH) / 2, 5000, 10000);
+    expectNear(sopDischarge(SOP_2S), SOP_MAX_DISCHARGE / 2, SOP_MAX_DISCHARGE / 10, "sop: half the limit halfway to SOP_TEMP_HIGH");
+    sopUpdate(0, 25, SOP_TEMP_HIGH, 5000, 10000);
+    expect(sopDischarge(SOP_2S) == 0 && sopCharge(SOP_2S) == 0, "sop: nothing at SOP_TEMP_HIGH");
+    sopUpdate(0, SOP_TEMP_COLD, 25, 5000, 10000);
+    expect(sopDischarge(SOP_2S) == SOP_MAX_DISCHARGE && sopCharge(SOP_2S) < SOP_MAX_CHARGE, "sop: charging is held back further in the cold");
+    sopUpdate(0, SOP_TEMP_LOW, 25, 5000, 10000);
+    expect(sopDischarge(SOP_2S) == 0, "sop: nothing at SOP_TEMP_LOW");
+
+    sopUpdate(0, 25, 25, SOP_SOC_DISCHARGE_FULL / 2, 10000);
+    expectNear(sopDischarge(SOP_2S), SOP_MAX_DISCHARGE / 2, 50, "sop: discharge ramps down below SOP_SOC_DISCHARGE_FULL");
+    expect(sopCharge(SOP_2S) == SOP_MAX_CHARGE, "sop: charge is not held back at low SOC");
+    sopUpdate(0, 25, 25, SOC_FULL, 10000);
+    expect(sopCharge(SOP_2S) == 0 && sopDischarge(SOP_2S) == SOP_MAX_DISCHARGE, "sop: no charge at full");
+
+    sopDerate(1);
+    sopUpdate(0, 25, 25, 5000, 10000);
+    expect(sopDischarge(SOP_2S) == SOP_MAX_DISCHARGE >> SOP_DERATE_SHIFT, "sop: a derate fault cuts the limit");
+    sopDerate(0);
+
+    section("sop", before, failedBefore);
+}
+
+/*SOH*/
+
+const int kRated = 12 * 3600000;    // mA*s, CAPACITY in main.c
+
+void sohReset()
+{
+    std::memset(eeprom, 0xFF, sizeof(eeprom));
+    anchorValid = 0;
+    sohChanged = 0;
+    lastSave = 0;
+    throughput = discharged = energy = 0;
+    throughputRemainder = dischargeRemainder = energyRemainder = 0;
+    sohInit(kRated);
+}
+
+// Runs current (mA) for seconds in 100mS samples
+void sohRun(int current, int seconds)
+{
+    for (int i = 0; i < seconds * 10; i++)
+        sohUpdate(current, 44400, 100);
+}
+
+void checkSoh()
+{
+    int before = checks, failedBefore = failures;
+
+    sohReset();
+    expect(sohCapacity() == kRated && sohHealth() == 1000, "soh: a fresh pack starts at rated");
+
+    // The pack really holds 10.2Ah, 85% of rated. Rest at 90%, run 80% out, rest
+    const double actual = 0.85 * kRated;
+    sohAnchor(9000);
+    for (int cycle = 0; cycle < 12; cycle++) {
+        sohRun(10000, static_cast<int>(actual * 0.8 / 10000));
+        sohAnchor(1000);
+        sohRun(-10000, static_cast<int>(actual * 0.8 / 10000));
+        sohAnchor(9000);
+    }
+    expectNear(sohHealth(), 850, 10, "soh: capacity converges on the measured fade");
+
+    long capacity = sohCapacity();
+    sohAnchor(8800);
+    sohRun(2000, 60);
+    sohAnchor(8000);
+    expect(sohCapacity() == capacity, "soh: a swing under SOH_MIN_DSOC leaves the capacity alone");
+
+    sohAnchor(9000);
+    sohRun(20000, 600);             // 3.3Ah for 80% of SOC is 35% of rated
+    sohAnchor(1000);
+    expect(sohCapacity() == capacity, "soh: a measurement under SOH_CAPACITY_MIN is thrown away");
+
+    sohReset();
+    sohRun(12000, 3600);            // One rated capacity out
+    expect(sohCycles() == 1, "soh: one rated capacity out is one cycle");
+    expect(sohThroughput() == 12000, "soh: throughput in mAh");
+    expectNear(sohEnergy(), 12000 * 44.4, 1, "soh: energy in mWh");
+    sohRun(-12000, 3600);
+    expect(sohCycles() == 1 && sohThroughput() == 24000, "soh: charge adds to throughput, not cycles");
+
+    sohAnchor(9000);
+    sohRun(10000, static_cast<int>(actual * 0.8 / 10000));
+    sohAnchor(1000);
+    eepromWrites = 0;
+    sohSave(1000);
+    expect(eepromWrites > 0, "soh: a capacity change is saved at once");
+    eepromWrites = 0;
+    sohSave(2000);
+    expect(eepromWrites == 0, "soh: nothing is saved again until SOH_SAVE_PERIOD");
+    sohSave(1000 + SOH_SAVE_PERIOD);
+    capacity = sohCapacity();
+    unsigned int cycles = sohCycles();
+    sohCap = 1;
+    throughput = discharged = 0;
+    sohInit(kRated);
+    expectNear(sohCapacity(), capacity, 3600, "soh: the capacity comes back from EEPROM");
+    expect(sohCycles() == cycles, "soh: the counters come back from EEPROM");
+
+    eepromWriteWord(EE_SOH_CAPACITY, 100);
+    sohInit(kRated);
+    expect(sohCapacity() == kRated, "soh: a corrupt capacity starts over at rated");
+
+    section("soh", before, failedBefore);
+}
+
+/*FAULT*/
+
+void faultStart()
+{
+    std::memset(faultInputs, 0, sizeof(faultInputs));
+    std::memset(faultCounts, 0, sizeof(faultCounts));
+    faultBits = 0;
+    faultLatch = 0;
+    faultInit();
+    faultInput(FAULT_SRC_CELL_MAX, 3700);
+    faultInput(FAULT_SRC_CELL_MIN, 3700);
+    faultInput(FAULT_SRC_TEMP_MAX, 25);
+    faultInput(FAULT_SRC_TEMP_MIN, 25);
+}
+
+void ticks(int n)
+{
+    for (int i = 0; i < n; i++)
+        faultTick();
+}
+
+void checkFault()
+{
+    int before = checks, failedBefore = failures;
+
+    faultStart();
+    ticks(10);
+    expect(faultActive() == 0 && faultActions() == 0, "fault: a healthy pack has no faults");
+
+    faultInput(FAULT_SRC_CELL_MAX, 4250);
+    ticks(4);
+    expect(faultActive() == 0, "fault: over voltage waits for its set count");
+    faultInput(FAULT_SRC_CELL_MAX, 4000);
+    ticks(1);
+    faultInput(FAULT_SRC_CELL_MAX, 4250);
+    ticks(4);
+    expect(faultActive() == 0, "fault: one good reading restarts the count");
+    ticks(1);
+    expect(faultActive() == FAULT_OVER_VOLTAGE && faultLatched() == FAULT_OVER_VOLTAGE, "fault: over voltage sets and latches");
+    expect(faultActions() == FAULT_OPEN_CHARGE, "fault: over voltage opens the charge path");
+
+    faultInput(FAULT_SRC_CELL_MAX, 4000);
+    ticks(1000);
+    expect(faultActive() == FAULT_OVER_VOLTAGE, "fault: a latched fault holds after the cause goes away");
+    faultReset();
+    ticks(199);
+    expect(faultActive() == FAULT_OVER_VOLTAGE, "fault: after a reset it waits for its clear count");
+    ticks(1);
+    expect(faultActive() == 0 && faultLatched() == 0, "fault: then clears");
+
+    faultStart();
+    faultInput(FAULT_SRC_TEMP_MAX, 36);
+    ticks(20);
+    expect(faultActive() == FAULT_HIGH_TEMP && faultLatched() == 0, "fault: high temperature is a warning, not latched");
+    expect(faultActions() == FAULT_DERATE, "fault: high temperature derates");
+    faultInput(FAULT_SRC_TEMP_MAX, 34);
+    ticks(500);
+    expect(faultActive() == FAULT_HIGH_TEMP, "fault: inside the hysteresis it holds");
+    faultInput(FAULT_SRC_TEMP_MAX, 33);
+    ticks(200);
+    expect(faultActive() == 0, "fault: past the clear threshold it clears on its own");
+
+    faultStart();
+    faultInput(FAULT_SRC_TEMP_MAX, 41);
+    faultInput(FAULT_SRC_DISCHARGE, 12000);
+    ticks(20);
+    expect(faultActive() == (FAULT_OVER_TEMP | FAULT_HIGH_TEMP | FAULT_OVER_CURRENT), "fault: faults set side by side");
+    expect(faultActions() == (FAULT_OPEN_DISCHARGE | FAULT_OPEN_CHARGE | FAULT_DERATE), "fault: their actions are OR'd");
+
+    faultStart();
+    faultSetLimit(5, 4150);
+    expect(faultLimit(5) == 4150 && faultClears[5] == 4050, "fault: a new limit keeps the table's hysteresis");
+    faultInput(FAULT_SRC_CELL_MAX, 4160);
+    ticks(5);
+    expect(faultActive() == FAULT_OVER_VOLTAGE, "fault: the moved limit is used");
+
+    faultStart();
+    faultInput(FAULT_SRC_TEMP_SENSORS, 1);
+    ticks(1);
+    expect(faultActive() == FAULT_TEMP_SENSOR, "fault: one lost thermistor warns");
+    faultInput(FAULT_SRC_TEMP_SENSORS, SENSOR_TEMPS_LOST);
+    ticks(1);
+    expect((faultLatched() & FAULT_TEMP_SENSORS_LOST) && (faultActions() & FAULT_OPEN_DISCHARGE), "fault: too many lost thermistors open the pack");
+
+    section("fault", before, failedBefore);
+}
+
+/*SENSOR*/
+
+void sensorReset()
+{
+    std::memset(sensorSeeded, 0, sizeof(sensorSeeded));
+    std::memset(sensorBad, 0, sizeof(sensorBad));
+    std::memset(sensorGood, 0, sizeof(sensorGood));
+    sensorFail = 0;
+}
+
+void checkSensor()
+{
+    int before = checks, failedBefore = failures;
+
+    sensorReset();
+    expect(sensorUpdate(0, 2048, 25) == 25 && sensorOk(0), "sensor: a good reading is used");
+    for (int i = 0; i < SENSOR_FAIL_COUNT - 1; i++)
+        expect(sensorUpdate(0, 4095, -273) == 25, "sensor: an open thermistor holds the last good value");
+    expect(sensorStatus(0) == SENSOR_OPEN && sensorOk(0), "sensor: open, not failed yet");
+    sensorUpdate(0, 4095, -273);
+    expect(!sensorOk(0) && sensorFailed() == 0x01 && sensorFailedTemps() == 1, "sensor: fails after SENSOR_FAIL_COUNT");
+    for (int i = 0; i < SENSOR_PASS_COUNT - 1; i++)
+        sensorUpdate(0, 2048, 25);
+    expect(!sensorOk(0), "sensor: stays failed until SENSOR_PASS_COUNT good readings");
+    sensorUpdate(0, 2048, 25);
+    expect(sensorOk(0) && sensorFailed() == 0, "sensor: then comes back");
+
+    sensorUpdate(1, 2048, 25);
+    sensorUpdate(1, 10, 148);
+    expect(sensorStatus(1) == SENSOR_SHORT, "sensor: a shorted thermistor is caught");
+
+    sensorUpdate(2, 2048, 25);
+    expect(sensorUpdate(2, 2048 - SENSOR_TEMP_RATE - 1, 29) == 25 && sensorStatus(2) == SENSOR_RATE, "sensor: a jump no pack can make is held");
+    expect(sensorUpdate(2, 2040, 26) == 26, "sensor: a plausible reading after it is used");
+
+    // 0.6V is the 78C/72C step of the LUT: two codes apart, 6C apart
+    sensorUpdate(3, 490, 78);
+    for (int i = 0; i < SENSOR_FAIL_COUNT; i++) {
+        sensorUpdate(3, i % 2 ? 490 : 492, i % 2 ? 78 : 72);
+        expect(sensorStatus(3) == SENSOR_OK, "sensor: one LUT step at the hot end is not a rate fault");
+    }
+    expect(sensorOk(3), "sensor: a thermistor sitting on a LUT step stays in max/min");
+
+    sensorUpdate(SENSOR_CURRENT, 2048, 2048);
+    expect(sensorUpdate(SENSOR_CURRENT, 3800, 3800) == 3800 && sensorStatus(SENSOR_CURRENT) == SENSOR_OK, "sensor: a current step is never held off");
+    sensorUpdate(SENSOR_CURRENT, 4095, 4095);
+    expect(sensorStatus(SENSOR_CURRENT) == SENSOR_RAIL, "sensor: a current sensor at the rail is caught");
+
+    section("sensor", before, failedBefore);
+}
+
+/*SLOPE*/
+
+void slopeReset()
+{
+    slopeSamples = 0;
+    slopeHead = 0;
+    std::memset(slopeDiffs, 0, sizeof(slopeDiffs));
+    std::memset(cellIr, 0, sizeof(cellIr));
+}
+
+void slopeRun(int samples, int temp0, int tempStep, int cell0, int cellStep, int current)
+{
+    int temps[SLOPE_TEMPS];
+    unsigned int codes[SLOPE_CELLS];
+    for (int s = 0; s < samples; s++) {
+        for (int i = 0; i < SLOPE_TEMPS; i++)
+            temps[i] = temp0 + (i == 2 ? tempStep * s : 0);
+        for (int i = 0; i < SLOPE_CELLS; i++)
+            codes[i] = cell0 + (i == 4 ? cellStep * s : 0) * 10
+                       - static_cast<int>(static_cast<long long>(current) * irGet(i) / 100000);
+        slopeUpdate(temps, codes, current);
+    }
+}
+
+void checkSlope()
+{
+    int before = checks, failedBefore = failures;
+    const int perMinute = 60000 / SLOPE_PERIOD;
+
+    slopeReset();
+    slopeRun(SLOPE_WINDOW - 1, 30, 1, 37000, -10, 0);
+    expect(slopeTempMax(0) == 0 && slopeCellMin() == 0, "slope: nothing until the window is full");
+
+    slopeReset();
+    slopeRun(20, 30, 1, 37000, -10, 0);
+    expectNear(slopeGet(2), perMinute, 0, "slope: a steady 1C per sample rise");
+    expectNear(slopeCellMin(), -10 * perMinute, 1, "slope: a steady 10mV per sample sag");
+    expect(slopeGet(0) == 0 && slopeGet(SLOPE_TEMPS) == 0, "slope: flat channels read flat");
+    expect(slopeRunaway(0), "slope: rise and sag together warn");
+    expect(!slopeRunaway(0x04), "slope: not when the rising thermistor has failed");
+
+    slopeReset();
+    slopeRun(20, 30, 1, 37000, 0, 0);
+    expect(!slopeRunaway(0), "slope: a rise alone does not warn");
+
+    slopeReset();
+    for (int i = 0; i < IR_CELLS; i++)
+        cellIr[i] = 3000;
+    int temps[SLOPE_TEMPS] = {25, 25, 25, 25, 25};
+    unsigned int codes[SLOPE_CELLS];
+    for (int s = 0; s < 20; s++) {
+        int current = s % 3 ? 9000 : 0;     // Load steps between samples
+        for (int i = 0; i < SLOPE_CELLS; i++)
+            codes[i] = 37000 - current * 3000 / 100000;
+        slopeUpdate(temps, codes, current);
+    }
+    expect(slopeCellMin() > -SLOPE_CELL_SAG / 5, "slope: load steps are backed out with the IR");
+
+    // current * IR alone is past a long here: 120A pulls and 60A of regen
+    // through a 25mOhm cell
+    slopeReset();
+    for (int i = 0; i < IR_CELLS; i++)
+        cellIr[i] = 25000;
+    int worst = 0;
+    for (int s = 0; s < 20; s++) {
+        int current = s % 2 ? 120000 - 3000 * s : -60000 + 2000 * s;
+        for (int i = 0; i < SLOPE_CELLS; i++)
+            codes[i] = 37000 - current / 10 * 25000 / 10000;
+        slopeUpdate(temps, codes, current);
+        worst = std::max(worst, std::abs(slopeLast[SLOPE_TEMPS] - 3700));
+    }
+    expect(worst <= 1, "slope: big currents at a high IR are backed out too");
+    expect(slopeCellMin() > -SLOPE_CELL_SAG / 5, "slope: and leave the cells flat");
+
+    section("slope", before, failedBefore);
+}
+
+} // namespace
+
+int main()
+{
+    checkIr();
+    checkSop();
+    checkSoh();
+    checkFault();
+    checkSensor();
+    checkSlope();
+    std::printf("%d checks, %d failures\n", checks, failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,266 @@
+/*
+ * File:   rainflow_check.cpp
+ * Author: trm84
+ *
+ * Created on October 20, 2026, 12:10 PM
+ *
+ * Host check for rainflow.c against an offline rainflow count. Builds the
+ * firmware source as is (long narrowed to the PIC's 32 bits, char unsigned
+ * as XC8 has it) and streams SOC signals through rainflowUpdate() one
+ * sample at a time. The reference takes the whole signal at once: turning
+ * points with the same RF_HYST, then the three point count of ASTM E1049
+ * (5.4.4), with what is left over counted as half cycles. The firmware's
+ * unclosed residue is counted the same way at the end, so as long as the
+ * residue never fills RF_STACK both histograms must match bin for bin.
+ * RF_STACK is sized so none of the random sessions fill it, one that does
+ * is a failure. Swings that keep growing fill any stack, they are checked
+ * on their own for the ranges retired as half cycles.
+ *
+ * Signals are hand made cases (rising first, falling first, nested and
+ * expanding swings) and random charge/discharge sessions.
+ *
+ * Build: g++ -std=c++17 -O2 -funsigned-char -o rainflow_check rainflow_check.cpp
+ * Use:   rainflow_check [sessions]
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#define long int // The PIC's long is 32 bits
+#include "../rainflow.c"
+#undef long
+
+// Data EEPROM, erased
+unsigned char eeprom[256];
+
+unsigned char eepromRead(unsigned char addr) { return eeprom[addr]; }
+void eepromWrite(unsigned char addr, unsigned char data) { eeprom[addr] = data; }
+unsigned int eepromReadWord(unsigned char addr) { return eeprom[addr] | (eeprom[addr + 1] << 8); }
+void eepromWriteWord(unsigned char addr, unsigned int data)
+{
+    eeprom[addr] = data & 0xFF;
+    eeprom[addr + 1] = data >> 8;
+}
+
+namespace {
+
+typedef std::vector<unsigned> Histogram;    // Half cycles, RF_DOD_BINS x RF_MEAN_BINS
+
+int failures = 0;
+int deepest = 0;                    // Most turning points the firmware held
+
+// Same bins as rfCount()
+void bin(Histogram &hist, int a, int b, unsigned halves)
+{
+    int dod = std::min(std::abs(a - b) / RF_DOD_STEP, RF_DOD_BINS - 1);
+    int mean = std::min((a / 2 + b / 2) / RF_MEAN_STEP, RF_MEAN_BINS - 1);
+    hist[dod * RF_MEAN_BINS + mean] += halves;
+}
+
+// Offline reference: turning points, then ASTM E1049 three point counting
+Histogram reference(const std::vector<int> &signal)
+{
+    std::vector<int> points = {signal[0]};
+    int extreme = signal[0];
+    int dir = 0;
+    for (size_t i = 1; i < signal.size(); i++) {
+        int s = signal[i];
+        if (dir == 0) {
+            if (s >= extreme + RF_HYST || s <= extreme - RF_HYST) {
+                dir = s > extreme ? 1 : -1;
+                extreme = s;
+            }
+        } else if (dir * (s - extreme) > 0) {
+            extreme = s;
+        } else if (dir * (extreme - s) >= RF_HYST) {
+            points.push_back(extreme);
+            dir = -dir;
+            extreme = s;
+        }
+    }
+    if (dir != 0)
+        points.push_back(extreme);  // Where the signal is heading now
+
+    Histogram hist(RF_DOD_BINS * RF_MEAN_BINS);
+    std::vector<int> stack;
+    for (int point : points) {
+        stack.push_back(point);
+        while (stack.size() >= 3) {
+            size_t n = stack.size();
+            int x = std::abs(stack[n - 1] - stack[n - 2]);
+            int y = std::abs(stack[n - 2] - stack[n - 3]);
+            if (x < y)
+                break;
+            if (n == 3) {           // Y holds the starting point: half a cycle
+                bin(hist, stack[0], stack[1], 1);
+                stack.erase(stack.begin());
+            } else {
+                bin(hist, stack[n - 3], stack[n - 2], 2);
+                stack.erase(stack.end() - 3, stack.end() - 1);
+            }
+        }
+    }
+    for (size_t i = 1; i < stack.size(); i++)
+        bin(hist, stack[i - 1], stack[i], 1);
+    return hist;
+}
+
+// Streams the signal through the firmware, then closes it out the way the
+// reference does: where the signal is heading is the last turning point and
+// what is still open counts as half cycles
+Histogram firmware(const std::vector<int> &signal, bool &overflowed)
+{
+    std::memset(rfHist, 0, sizeof(rfHist));
+    std::memset(eeprom, 0xFF, sizeof(eeprom));
+    rainflowInit(signal[0]);
+    overflowed = false;
+    unsigned counted = 0;
+    for (size_t i = 1; i < signal.size(); i++) {
+        rainflowUpdate(signal[i]);
+        deepest = std::max(deepest, rfPoints);
+        unsigned now = 0;
+        for (int d = 0; d < RF_DOD_BINS; d++)
+            for (int m = 0; m < RF_MEAN_BINS; m++)
+                now += rainflowCount(d, m);
+        overflowed = overflowed || (now - counted) % 2 != 0;   // Only a retired range counts one half
+        counted = now;
+    }
+    if (rfDir != 0)
+        rfPush(rfExtreme);
+
+    Histogram hist(RF_DOD_BINS * RF_MEAN_BINS);
+    for (int d = 0; d < RF_DOD_BINS; d++)
+        for (int m = 0; m < RF_MEAN_BINS; m++)
+            hist[d * RF_MEAN_BINS + m] = rainflowCount(d, m);
+    for (int i = 1; i < rfPoints; i++)
+        bin(hist, rfStack[i - 1], rfStack[i], 1);
+    return hist;
+}
+
+void print(const char *name, const Histogram &hist)
+{
+    std::printf("  %-9s", name);
+    for (unsigned h : hist)
+        std::printf(" %u", h);
+    std::printf("\n");
+}
+
+bool compare(const char *what, const std::vector<int> &signal)
+{
+    bool overflowed;
+    Histogram got = firmware(signal, overflowed);
+    Histogram want = reference(signal);
+    if (got == want)
+        return true;
+    if (failures++ < 5) {
+        std::printf("FAIL %s%s\n", what, overflowed ? " (residue filled the stack)" : "");
+        print("firmware", got);
+        print("reference", want);
+    }
+    return false;
+}
+
+// Straight lines between the given SOCs in 0.5% steps, as the SOC moves
+std::vector<int> ramp(std::initializer_list<int> corners)
+{
+    std::vector<int> signal;
+    std::vector<int> c(corners);
+    signal.push_back(c[0]);
+    for (size_t i = 1; i < c.size(); i++) {
+        int step = c[i] > c[i - 1] ? 50 : -50;
+        for (int s = c[i - 1] + step; step > 0 ? s < c[i] : s > c[i]; s += step)
+            signal.push_back(s);
+        signal.push_back(c[i]);
+    }
+    return signal;
+}
+
+void expectHalves(int dodBin, int meanBin, unsigned want, const char *what)
+{
+    if (rainflowCount(dodBin, meanBin) != want && failures++ < 5)
+        std::printf("FAIL %s: %u half cycles, want %u\n", what, rainflowCount(dodBin, meanBin), want);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    int sessions = argc > 1 ? std::atoi(argv[1]) : 2000;
+
+    // Hand counted: 7000-5000 closes inside 3000-8000 (DoD 20-40%, mean 50-75%)
+    bool overflowed;
+    compare("rising first", ramp({2000, 8000, 3000, 7000, 5000, 9000, 1000}));
+    compare("falling first", ramp({9000, 3000, 7000, 5000, 8000, 1000}));
+    firmware(ramp({9000, 3000, 7000, 5000, 8000, 1000}), overflowed);
+    expectHalves(1, 2, 2, "falling first: the 7000-5000 cycle");
+    expectHalves(0, 0, 0, "falling first: no noise sized cycles");
+    compare("nested", ramp({5000, 9500, 500, 8000, 2000, 6000, 4000, 5500, 4500, 9900}));
+    compare("small wiggles under RF_HYST", ramp({6000, 5950, 6040, 5960, 6000, 3000}));
+
+    // Swings that keep growing never close: once the stack is full its
+    // oldest range is retired as a half cycle each turn
+    const int swings = RF_STACK + 4;
+    std::vector<int> expanding = {5000};
+    for (int k = 1; k <= swings; k++)
+        expanding.push_back(5000 + (k % 2 ? -1 : 1) * (4000 / swings) * k);
+    std::memset(rfHist, 0, sizeof(rfHist));
+    rainflowInit(expanding[0]);
+    for (size_t i = 1; i < expanding.size(); i++)
+        for (int s : ramp({expanding[i - 1], expanding[i]}))
+            rainflowUpdate(s);
+    unsigned retired = 0;
+    for (int d = 0; d < RF_DOD_BINS; d++)
+        for (int m = 0; m < RF_MEAN_BINS; m++)
+            retired += rainflowCount(d, m);
+    if ((rfPoints != RF_STACK - 1 || retired != swings - (RF_STACK - 1)) && failures++ < 5)
+        std::printf("FAIL expanding swings: %d points held, %u half cycles retired\n", rfPoints, retired);
+
+    // Random sessions: drive down, charge up, partial top ups and dips
+    std::mt19937 rng(1);
+    deepest = 0;
+    int compared = 0;
+    for (int n = 0; n < sessions; n++) {
+        std::uniform_int_distribution<int> soc(0, SOC_FULL);
+        std::uniform_int_distribution<int> depth(200, 6000);
+        std::vector<int> corners = {soc(rng)};
+        int swings = 4 + rng() % 40;
+        for (int k = 0; k < swings; k++) {     // Alternate discharge and charge
+            int d = k % 2 ? depth(rng) : -depth(rng);
+            corners.push_back(std::clamp(corners.back() + d, 0, static_cast<int>(SOC_FULL)));
+        }
+        std::vector<int> signal = {corners[0]};
+        std::normal_distribution<double> noise(0.0, 20.0);
+        for (size_t i = 1; i < corners.size(); i++) {
+            int step = corners[i] > corners[i - 1] ? 37 : -37;
+            for (int s = corners[i - 1] + step; step > 0 ? s < corners[i] : s > corners[i]; s += step)
+                signal.push_back(std::clamp(s + static_cast<int>(noise(rng)), 0, static_cast<int>(SOC_FULL)));
+        }
+        firmware(signal, overflowed);
+        if (overflowed) {           // The firmware retired ranges the reference still holds
+            if (failures++ < 5)
+                std::printf("FAIL random session %d: the residue filled RF_STACK\n", n);
+            continue;
+        }
+        compare("random session", signal);
+        compared++;
+    }
+
+    // The histogram survives a reset
+    firmware(ramp({9000, 1000, 9000, 1000}), overflowed);
+    unsigned before = rainflowCount(4, 2);
+    rainflowSave(RF_SAVE_PERIOD);
+    std::memset(rfHist, 0, sizeof(rfHist));
+    rainflowInit(5000);
+    if (rainflowCount(4, 2) != before && failures++ < 5)
+        std::printf("FAIL the histogram did not come back from EEPROM\n");
+
+    std::printf("%d of %d random sessions matched the reference, at most %d of %d turning points held\n",
+                compared, sessions, deepest, RF_STACK);
+    std::printf("%d failures\n", failures);
+    return failures == 0 ? 0 : 1;
+}
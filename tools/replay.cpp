@@ -0,0 +1,427 @@
+/*
+ * File:   replay.cpp
+ * Author: trm84
+ *
+ * Created on October 20, 2026, 6:50 AM
+ *
+ * Offline replay of a recorded binary telemetry stream (see telemetry.h)
+ * through the firmware's own decision code: balance.c, the coulomb counter,
+ * EKF and OCV correction, the IR and slope trends, and the fault table. The
+ * sources are built as they are, with long narrowed to the PIC's 32 bits.
+ * Status frames, or the current, temps and cells channels, drive it. Every
+ * frame with a new current or cell reading is one pass at the recorded time.
+ * The slow work runs every UART_PERIOD of log time, as in main.c.
+ *
+ * One CSV row is written per slow pass and on every change of balancing,
+ * faults or actions, with what the firmware reported next to it where the
+ * log has it. The summary compares the two. Tuning is passed the same way
+ * the command interface takes it, so a change can be tried on old logs
+ * before it is flashed.
+ *
+ * Debounce counts are in passes, so faults take longer to set on a 20Hz
+ * log than on the ~100Hz loop. Thermistor and current sensor health come
+ * from the failed sensor bits in the log, not the raw codes.
+ *
+ * Build: g++ -std=c++17 -O2 -o replay replay.cpp
+ * Use:   replay [-b mV] [-l ov=4150 ...] [-c Ah] [-s soc%] capture.bin > decisions.csv
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#define long int // The PIC's long is 32 bits
+#include "../balance.c"
+#include "../coulomb.c"
+#include "../ocv.c"
+#include "../ekf.c"
+#include "../ir.c"
+#include "../slope.c"
+#include "../fault.c"
+#include "../delta.c"
+#undef long
+
+namespace {
+
+// As in main.c
+const int kCells = 12;
+const int kTemps = 5;
+const int kCapacity = 12;           // Ahr, CAPACITY
+const uint32_t kSlowPeriod = 1000;  // mS, UART_PERIOD
+
+const size_t kHeader = 5;           // Type, sequence number, time
+const size_t kStatusSize = 48;      // Including the CRC
+
+struct Limit {
+    const char *name;
+    char fault;                     // Row in the fault table, as in command.c
+};
+
+const Limit kLimits[] = {
+    {"ot", 0}, {"ht", 1}, {"ut", 2}, {"oc", 3}, {"occ", 4}, {"ov", 5}, {"uv", 6},
+};
+
+// Latest readings from the log, and what the firmware made of them
+struct Log {
+    unsigned int codes[kCells] = {};
+    bool haveCells = false;
+    uint16_t cellSeq = 0;
+    int32_t current = 0;
+    int temps[kTemps] = {25, 25, 25, 25, 25};
+    unsigned failed = 0;            // Failed sensor bits
+    bool haveSoc = false;
+    int soc = 0;
+    int ekf = 0;
+    bool haveFaults = false;
+    unsigned faults = 0;
+    bool haveTime = false;
+    uint32_t time = 0;              // mS, unwrapped
+};
+
+struct Replay {
+    int threshold = BALANCE_THRESHOLD;
+    std::vector<std::pair<char, int>> limits;
+    int capacity = kCapacity;
+    int startSoc = -1;              // 0.01%, -1 takes it from the log
+    bool started = false;
+    uint32_t lastPass = 0;
+    uint32_t lastSlow = 0;
+    uint32_t lastSlope = 0;
+    int32_t lastCharge = 0;
+    unsigned bleed = 0;
+    unsigned faults = 0;
+    unsigned actions = 0;
+    // Summary
+    size_t passes = 0;
+    size_t rows = 0;
+    size_t faultSets = 0;
+    size_t bleedChanges = 0;
+    size_t faultDiffers = 0;
+    size_t compared = 0;
+    int worstSoc = 0;               // Largest |replayed - logged| SOC (0.01%)
+    uint32_t firstTime = 0;
+};
+
+uint16_t crc16(const uint8_t *data, size_t length)
+{
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= static_cast<uint16_t>(data[i]) << 8;
+        for (int b = 0; b < 8; b++)
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+// Decodes one COBS frame (without its 0x00). Returns false if it is malformed.
+bool cobsDecode(const std::vector<uint8_t> &in, std::vector<uint8_t> &out)
+{
+    out.clear();
+    size_t i = 0;
+    while (i < in.size()) {
+        uint8_t code = in[i++];
+        if (code == 0 || i + code - 1 > in.size())
+            return false;
+        for (uint8_t k = 1; k < code; k++)
+            out.push_back(in[i++]);
+        if (code != 0xFF && i < in.size())
+            out.push_back(0);
+    }
+    return true;
+}
+
+unsigned u16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+int32_t s32(const uint8_t *p)
+{
+    return static_cast<int32_t>(p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24));
+}
+
+int clampCurrent(int32_t current)
+{
+    return current > 32000 ? 32000 : current < -32000 ? -32000 : static_cast<int>(current);
+}
+
+unsigned averageCode(const Log &log)
+{
+    uint32_t total = 0;
+    for (int c = 0; c < kCells; c++)
+        total += log.codes[c];
+    return total / kCells;
+}
+
+void printRow(const Log &log, Replay &rp)
+{
+    rp.rows++;
+    std::printf("%.3f,%d,%d,%d,0x%03X,0x%04X,0x%X", log.time / 1000.0, static_cast<int>(log.current),
+                coulombSoc(), ekfSoc(), rp.bleed, rp.faults, rp.actions);
+    if (log.haveSoc)
+        std::printf(",%d,%d", log.soc, log.ekf);
+    else
+        std::printf(",,");
+    if (log.haveFaults)
+        std::printf(",0x%04X\n", log.faults);
+    else
+        std::printf(",\n");
+}
+
+// One main loop pass at the log's time
+void pass(Log &log, Replay &rp, bool newCells)
+{
+    uint32_t now = log.time;
+    if (!log.haveCells)
+        return;
+    if (!rp.started) {
+        int soc = rp.startSoc >= 0 ? rp.startSoc
+                  : log.haveSoc     ? log.soc
+                                    : ocvToSoc(averageCode(log) / 10);
+        coulombInit(static_cast<int32_t>(rp.capacity) * 3600000, soc);
+        ekfInit(static_cast<int32_t>(rp.capacity) * 3600000, soc);
+        faultInit();
+        for (auto &limit : rp.limits)
+            faultSetLimit(limit.first, limit.second);
+        rp.started = true;
+        rp.firstTime = rp.lastPass = rp.lastSlow = rp.lastSlope = now;
+        rp.lastCharge = coulombCharge();
+    }
+    rp.passes++;
+
+    coulombUpdate(log.current, now - rp.lastPass);
+    restUpdate(log.current, now);
+    rp.lastPass = now;
+    if (newCells)
+        irUpdate(log.codes, log.current, now);
+
+    int highest = 0, lowest = 0;
+    bool found = false;
+    for (int t = 0; t < kTemps; t++) {
+        if (log.failed & (1u << t))
+            continue;
+        if (!found || log.temps[t] > highest)
+            highest = log.temps[t];
+        if (!found || log.temps[t] < lowest)
+            lowest = log.temps[t];
+        found = true;
+    }
+    if (!found)
+        highest = lowest = SENSOR_TEMP_NONE;
+    unsigned cellMin = 0, cellMax = 0;
+    for (int c = 0; c < kCells; c++) {
+        if (log.codes[c] < 1000)    // Under 0.1V is a loose tap, as in readVoltages()
+            continue;
+        if (cellMin == 0 || log.codes[c] < cellMin)
+            cellMin = log.codes[c];
+        if (log.codes[c] > cellMax)
+            cellMax = log.codes[c];
+    }
+    int lostTemps = 0;
+    for (int t = 0; t < kTemps; t++)
+        lostTemps += (log.failed >> t) & 1;
+
+    faultInput(FAULT_SRC_TEMP_MAX, highest);
+    faultInput(FAULT_SRC_TEMP_MIN, lowest);
+    faultInput(FAULT_SRC_TEMP_SENSORS, lostTemps);
+    faultInput(FAULT_SRC_CURRENT_SENSOR, (log.failed & (1u << SENSOR_CURRENT)) ? 1 : 0);
+    faultInput(FAULT_SRC_DISCHARGE, clampCurrent(log.current));
+    faultInput(FAULT_SRC_CHARGE, clampCurrent(-log.current));
+    faultInput(FAULT_SRC_CELL_MAX, cellMax / 10);
+    faultInput(FAULT_SRC_CELL_MIN, cellMin / 10);
+    faultInput(FAULT_SRC_RUNAWAY, slopeRunaway(log.failed));
+    unsigned actions = faultTick();
+    unsigned faults = faultActive();
+    rp.faultSets += __builtin_popcount(faults & ~rp.faults);
+    bool changed = faults != rp.faults || actions != rp.actions;
+    rp.faults = faults;
+    rp.actions = actions;
+
+    if (now - rp.lastSlope >= SLOPE_PERIOD) {
+        slopeUpdate(log.temps, log.codes, log.current);
+        rp.lastSlope += SLOPE_PERIOD;
+    }
+    if (now - rp.lastSlow >= kSlowPeriod) {
+        unsigned bleed = balanceCells(log.codes, kCells, rp.threshold);
+        if (bleed != rp.bleed)
+            rp.bleedChanges++;
+        rp.bleed = bleed;
+        ekfUpdate(coulombCharge() - rp.lastCharge, log.current, averageCode(log), now - rp.lastSlow);
+        ocvCorrect(averageCode(log) / 10, now);
+        rp.lastCharge = coulombCharge();
+        rp.lastSlow = now;
+        changed = true;
+    }
+
+    if (log.haveSoc)
+        rp.worstSoc = std::max(rp.worstSoc, std::abs(coulombSoc() - log.soc));
+    if (log.haveFaults) {
+        rp.compared++;
+        if (log.faults != faults)
+            rp.faultDiffers++;
+    }
+    if (changed)
+        printRow(log, rp);
+}
+
+void handleFrame(const std::vector<uint8_t> &raw, Log &log, Replay &rp, size_t &bad)
+{
+    std::vector<uint8_t> frame;
+    if (!cobsDecode(raw, frame) || frame.size() < kHeader + 2) {
+        bad++;
+        return;
+    }
+    size_t body = frame.size() - 2;
+    if (crc16(frame.data(), body) != u16(&frame[body])) {
+        bad++;
+        return;
+    }
+    if (frame[0] == 0x02)           // Command reply, no header
+        return;
+    uint16_t seq = static_cast<uint16_t>(u16(&frame[1]));
+    uint16_t stamp = static_cast<uint16_t>(u16(&frame[3]));
+    log.time = log.haveTime ? log.time + static_cast<uint16_t>(stamp - log.time) : stamp;
+    log.haveTime = true;
+    const uint8_t *p = &frame[kHeader];
+
+    switch (frame[0]) {
+    case 0x01:                      // Status
+        if (frame.size() != kStatusSize)
+            return;
+        for (int c = 0; c < kCells; c++)
+            log.codes[c] = u16(p + 2 * c);
+        log.haveCells = true;
+        log.current = s32(p + 24);
+        for (int t = 0; t < kTemps; t++)
+            log.temps[t] = static_cast<int8_t>(p[28 + t]);
+        log.soc = static_cast<int16_t>(u16(p + 33));
+        log.ekf = static_cast<int16_t>(u16(p + 35));
+        log.haveSoc = true;
+        log.faults = u16(p + 37);
+        log.haveFaults = true;
+        log.failed = p[40];
+        pass(log, rp, true);
+        break;
+    case 0x10:                      // Current
+        log.current = s32(p);
+        pass(log, rp, false);
+        break;
+    case 0x12:                      // SOC
+        log.soc = static_cast<int16_t>(u16(p));
+        log.ekf = static_cast<int16_t>(u16(p + 2));
+        log.haveSoc = true;
+        break;
+    case 0x13:                      // Faults
+        log.faults = u16(p);
+        log.haveFaults = true;
+        log.failed = p[3];
+        break;
+    case 0x14:                      // Temps
+        for (int t = 0; t < kTemps; t++)
+            log.temps[t] = static_cast<int8_t>(p[t]);
+        break;
+    case 0x15:                      // Cells, key frame
+        for (int c = 0; c < kCells; c++)
+            log.codes[c] = u16(p + 2 * c);
+        log.haveCells = true;
+        log.cellSeq = seq;
+        pass(log, rp, true);
+        break;
+    case 0x16:                      // Cells, delta on the last cells frame
+        if (!log.haveCells || u16(p) != log.cellSeq ||
+            deltaDecode(p + 2, static_cast<int>(body - kHeader - 2), log.codes, kCells) == 0) {
+            log.haveCells = false;  // Wait for a key frame
+            return;
+        }
+        log.cellSeq = seq;
+        pass(log, rp, true);
+        break;
+    }
+}
+
+bool parseLimit(const char *arg, Replay &rp)
+{
+    std::string text(arg);
+    size_t eq = text.find('=');
+    if (eq == std::string::npos)
+        return false;
+    for (const Limit &limit : kLimits) {
+        if (text.compare(0, eq, limit.name) == 0) {
+            rp.limits.push_back({limit.fault, std::atoi(text.c_str() + eq + 1)});
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Replay rp;
+    const char *path = nullptr;
+    for (int a = 1; a < argc; a++) {
+        if (!std::strcmp(argv[a], "-b") && a + 1 < argc) {
+            rp.threshold = std::atoi(argv[++a]);
+        } else if (!std::strcmp(argv[a], "-l") && a + 1 < argc && parseLimit(argv[a + 1], rp)) {
+            a++;
+        } else if (!std::strcmp(argv[a], "-c") && a + 1 < argc) {
+            rp.capacity = std::atoi(argv[++a]);
+        } else if (!std::strcmp(argv[a], "-s") && a + 1 < argc) {
+            rp.startSoc = std::atoi(argv[++a]) * 100;
+        } else if (argv[a][0] != '-' && !path) {
+            path = argv[a];
+        } else {
+            std::fprintf(stderr, "use: replay [-b mV] [-l ot|ht|ut|oc|occ|ov|uv=value] [-c Ah] [-s soc%%] [capture.bin]\n");
+            return 2;
+        }
+    }
+    std::ifstream file;
+    if (path) {
+        file.open(path, std::ios::binary);
+        if (!file) {
+            std::fprintf(stderr, "can't open %s\n", path);
+            return 1;
+        }
+    }
+    std::istream &in = path ? file : std::cin;
+
+    auto start = std::chrono::steady_clock::now();
+    Log log;
+    size_t bad = 0;
+    std::vector<uint8_t> raw;
+    bool synced = false; // Bytes before the first 0x00 are a partial frame
+    char c;
+    std::printf("time,current,soc,ekf,bleed,faults,actions,log_soc,log_ekf,log_faults\n");
+    while (in.get(c)) {
+        uint8_t byte = static_cast<uint8_t>(c);
+        if (byte != 0) {
+            raw.push_back(byte);
+            continue;
+        }
+        if (synced && !raw.empty())
+            handleFrame(raw, log, rp, bad);
+        synced = true;
+        raw.clear();
+    }
+    double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if (!rp.started) {
+        std::fprintf(stderr, "no cell readings in the log\n");
+        return 1;
+    }
+    double span = (log.time - rp.firstTime) / 1000.0;
+    std::fprintf(stderr, "%zu passes over %.0f S of log in %.3f S (%.0fx real time), %zu rows, %zu bad frames\n",
+                 rp.passes, span, wall, wall > 0 ? span / wall : 0.0, rp.rows, bad);
+    std::fprintf(stderr, "%zu faults set, %zu balancing changes", rp.faultSets, rp.bleedChanges);
+    if (rp.compared)
+        std::fprintf(stderr, ", fault bits differ from the log on %zu of %zu passes", rp.faultDiffers, rp.compared);
+    std::fprintf(stderr, "\n");
+    if (log.haveSoc)
+        std::fprintf(stderr, "SOC %.2f%% against %.2f%% logged, at most %.2f%% apart\n",
+                     coulombSoc() / 100.0, log.soc / 100.0, rp.worstSoc / 100.0);
+    return 0;
+}
@@ -0,0 +1,397 @@
+/*
+ * File:   tlm_decode.cpp
+ * Author: trm84
+ *
+ * Created on October 19, 2026, 10:45 PM
+ *
+ * Host decoder for the binary telemetry stream (see telemetry.h). Splits a
+ * raw serial capture on the 0x00 delimiters, COBS decodes each frame, checks
+ * the CRC and prints one line per status frame, one tagged line per
+ * subscribed channel frame, and command replies as text. Cell delta frames
+ * are applied with the firmware's own delta.c, a line for each update they
+ * hold; one that builds on a lost frame is reported and the cells wait for
+ * the next key frame.
+ * Every frame carries a sequence number and the mS it was built. The summary
+ * at the end counts sequence gaps and bad frames, gives each frame type's
+ * spacing with a histogram of how far each gap was from the usual one, and
+ * the main loop period from any loop frames (sub loop <ms>).
+ *
+ * Build: g++ -std=c++17 -O2 -o tlm_decode tlm_decode.cpp
+ * Use:   tlm_decode capture.bin      (or pipe the serial port into stdin)
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <vector>
+
+#include "../delta.c"
+
+namespace {
+
+const uint8_t kTypeStatus = 0x01;
+const uint8_t kTypeReply = 0x02;
+const size_t kStatusSize = 48;      // Including the CRC
+const size_t kHeader = 5;           // Type, sequence number, time
+const uint8_t kTypeLoop = 0x17;
+const int kJitterBins = 9;          // -4 or less ... +4 or more mS from the usual gap
+
+const uint8_t kTypeCells = 0x15;
+const uint8_t kTypeCellsDelta = 0x16;
+
+struct Channel {
+    uint8_t type;
+    size_t size;        // Header, payload and CRC
+    const char *name;
+};
+
+const Channel kChannels[] = {       // TLM_x channel frames in telemetry.h
+    {0x10, 11, "current"}, {0x11, 11, "minmax"}, {0x12, 11, "soc"},
+    {0x13, 11, "faults"}, {0x14, 12, "temps"}, {0x15, 31, "cells"},
+    {0x16, 0, "delta"},                 // Any length
+    {0x17, 13, "loop"}, {0x18, 15, "sop"},
+    {0x20, 21, "capture"}, {0x21, 40, "samples"},     // Burst capture, cap_wave rebuilds it
+    {0x22, 0, "trace"},                 // Black box dump, trace_decode prints the records
+};
+const int kCells = 12;
+const int kTemps = 5;
+
+const char *kFaultNames[] = {   // FAULT_x bit order in fault.h
+    "OVER_TEMP", "HIGH_TEMP", "UNDER_TEMP", "OVER_CURRENT", "CHARGE_CURRENT",
+    "OVER_VOLTAGE", "UNDER_VOLTAGE", "TEMP_SENSOR", "TEMP_SENSORS_LOST",
+    "CURRENT_SENSOR", "RUNAWAY_WARNING",
+};
+
+struct Stats {
+    size_t frames = 0;
+    size_t badCrc = 0;
+    size_t badCobs = 0;
+    size_t unknown = 0;
+    size_t dropped = 0;
+    bool haveSeq = false;
+    uint16_t nextSeq = 0;
+    unsigned int cellRef[kCells] = {};  // Cells as of the last key or delta frame
+    bool haveCells = false;
+    uint16_t cellSeq = 0;
+    size_t keyFrames = 0;
+    size_t deltaFrames = 0;
+    size_t deltaUpdates = 0;            // Cells updates in the delta frames
+    size_t keyBytes = 0;                // On the wire
+    size_t deltaBytes = 0;
+    size_t stale = 0;                   // Deltas that built on a lost frame
+    bool haveTime = false;
+    uint32_t time = 0;                  // mS, unwrapped from the 16 bit stamps
+    std::map<uint8_t, uint32_t> lastTime;           // Per frame type
+    std::map<uint8_t, std::vector<uint32_t>> gaps;  // mS between frames of a type
+    uint32_t loopPasses = 0;
+    uint32_t loopWindow = 0;            // mS
+    unsigned loopMin = 255;
+    unsigned loopMax = 0;
+    std::map<unsigned, size_t> loopWorst;           // Longest pass of each loop frame
+};
+
+const char *typeName(uint8_t type)
+{
+    if (type == kTypeStatus)
+        return "status";
+    for (const Channel &ch : kChannels)
+        if (ch.type == type)
+            return ch.name;
+    return "?";
+}
+
+uint16_t crc16(const uint8_t *data, size_t length)
+{
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= static_cast<uint16_t>(data[i]) << 8;
+        for (int b = 0; b < 8; b++)
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+// Decodes one COBS frame (without its 0x00). Returns false if it is malformed.
+bool cobsDecode(const std::vector<uint8_t> &in, std::vector<uint8_t> &out)
+{
+    out.clear();
+    size_t i = 0;
+    while (i < in.size()) {
+        uint8_t code = in[i++];
+        if (code == 0 || i + code - 1 > in.size())
+            return false;
+        for (uint8_t k = 1; k < code; k++)
+            out.push_back(in[i++]);
+        if (code != 0xFF && i < in.size())
+            out.push_back(0);
+    }
+    return true;
+}
+
+unsigned u16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+
+void printFaults(unsigned faults)
+{
+    for (size_t b = 0; b < sizeof(kFaultNames) / sizeof(kFaultNames[0]); b++)
+        if (faults & (1u << b))
+            std::printf(" %s", kFaultNames[b]);
+}
+
+void printStatus(const uint8_t *f)
+{
+    const uint8_t *p = f + kHeader;
+    for (int c = 0; c < kCells; c++)
+        std::printf(" %6.4f", u16(p + 2 * c) / 10000.0);
+    int32_t current = static_cast<int32_t>(p[24] | (p[25] << 8) | (p[26] << 16) |
+                                           (static_cast<uint32_t>(p[27]) << 24));
+    std::printf("  %8.3fA ", current / 1000.0);
+    for (int t = 0; t < kTemps; t++)
+        std::printf(" %4d", static_cast<int8_t>(p[28 + t]));
+    std::printf("C  %6.2f%% %6.2f%%", u16(p + 33) / 100.0, u16(p + 35) / 100.0);
+    unsigned faults = u16(p + 37);
+    std::printf("  act 0x%X sens 0x%02X", p[39], p[40]);
+    printFaults(faults);
+    std::printf("\n");
+}
+
+void printChannel(const Channel &ch, const uint8_t *f)
+{
+    const uint8_t *p = f + kHeader;
+    std::printf(" %-7s", ch.name);
+    switch (ch.type) {
+    case 0x10:
+        std::printf(" %8.3fA", static_cast<int32_t>(p[0] | (p[1] << 8) | (p[2] << 16) |
+                                                     (static_cast<uint32_t>(p[3]) << 24)) / 1000.0);
+        break;
+    case 0x11:
+        std::printf(" %6.4f %6.4f", u16(p) / 10000.0, u16(p + 2) / 10000.0);
+        break;
+    case 0x12:
+        std::printf(" %6.2f%% %6.2f%%", u16(p) / 100.0, u16(p + 2) / 100.0);
+        break;
+    case 0x13:
+        std::printf(" act 0x%X sens 0x%02X", p[2], p[3]);
+        printFaults(u16(p));
+        break;
+    case 0x14:
+        for (int t = 0; t < kTemps; t++)
+            std::printf(" %4d", static_cast<int8_t>(p[t]));
+        std::printf("C");
+        break;
+    case 0x18:
+        std::printf(" discharge %6.3fA %6.3fA  charge %6.3fA %6.3fA  (2S, 10S)", u16(p) / 1000.0,
+                    u16(p + 2) / 1000.0, u16(p + 4) / 1000.0, u16(p + 6) / 1000.0);
+        break;
+    case kTypeLoop:
+        if (u16(p) == 0)
+            std::printf(" no passes yet");
+        else
+            std::printf(" %u passes in %u mS, %u-%u mS", u16(p), u16(p + 2), p[4], p[5]);
+        break;
+    case 0x20:
+        std::printf(" %u samples every %uuS, %u before, at %u mS", p[2], u16(p), p[3],
+                    p[4] | (p[5] << 8) | (p[6] << 16) | (static_cast<uint32_t>(p[7]) << 24));
+        break;
+    case 0x21:
+        std::printf(" from %u", p[0]);
+        break;
+    case 0x22:
+        std::printf(" records from %u of %u%s", p[3], p[1], p[2] ? ", frozen by a trip" : "");
+        break;
+    default:
+        for (int c = 0; c < kCells; c++)
+            std::printf(" %6.4f", u16(p + 2 * c) / 10000.0);
+        break;
+    }
+    std::printf("\n");
+}
+
+void handleFrame(const std::vector<uint8_t> &raw, Stats &stats)
+{
+    std::vector<uint8_t> frame;
+    if (!cobsDecode(raw, frame) || frame.size() < 3) {
+        stats.badCobs++;
+        return;
+    }
+    size_t body = frame.size() - 2;
+    if (crc16(frame.data(), body) != u16(&frame[body])) {
+        stats.badCrc++;
+        return;
+    }
+    if (frame[0] == kTypeReply) {
+        std::printf("reply: %.*s\n", static_cast<int>(body - 1),
+                    reinterpret_cast<const char *>(&frame[1]));
+        return;
+    }
+    const Channel *channel = nullptr;
+    for (const Channel &ch : kChannels)
+        if (frame[0] == ch.type && (frame.size() == ch.size || (ch.size == 0 && frame.size() >= 8)))
+            channel = &ch;
+    if (!channel && (frame[0] != kTypeStatus || frame.size() != kStatusSize)) {
+        stats.unknown++;
+        return;
+    }
+
+    uint16_t seq = static_cast<uint16_t>(u16(&frame[1]));
+    if (stats.haveSeq && seq != stats.nextSeq) {
+        uint16_t gap = seq - stats.nextSeq;
+        stats.dropped += gap;
+        std::printf("-- %u frames dropped\n", gap);
+    }
+    stats.haveSeq = true;
+    stats.nextSeq = seq + 1;
+    stats.frames++;
+
+    // Unwrap the 16 bit time against the last frame, they are never 65S apart
+    uint16_t stamp = static_cast<uint16_t>(u16(&frame[3]));
+    stats.time = stats.haveTime ? stats.time + static_cast<uint16_t>(stamp - stats.time) : stamp;
+    stats.haveTime = true;
+    uint8_t stream = frame[0] == kTypeCellsDelta ? kTypeCells : frame[0];  // Key and delta are one channel
+    auto last = stats.lastTime.find(stream);
+    if (last != stats.lastTime.end())
+        stats.gaps[stream].push_back(stats.time - last->second);
+    stats.lastTime[stream] = stats.time;
+    std::printf("%5u %9.3f ", seq, stats.time / 1000.0);
+
+    if (frame[0] == kTypeLoop) {
+        const uint8_t *p = &frame[kHeader];
+        stats.loopPasses += u16(p);
+        stats.loopWindow += u16(p + 2);
+        if (u16(p) != 0) {
+            stats.loopMin = std::min<unsigned>(stats.loopMin, p[4]);
+            stats.loopMax = std::max<unsigned>(stats.loopMax, p[5]);
+            stats.loopWorst[p[5]]++;
+        }
+    }
+    if (frame[0] == kTypeCells) {
+        for (int c = 0; c < kCells; c++)
+            stats.cellRef[c] = u16(&frame[kHeader + 2 * c]);
+        stats.haveCells = true;
+        stats.cellSeq = seq;
+        stats.keyFrames++;
+        stats.keyBytes += frame.size() + 2;     // COBS code byte and the 0x00
+    } else if (frame[0] == kTypeCellsDelta) {
+        stats.deltaFrames++;
+        stats.deltaBytes += frame.size() + 2;
+        unsigned base = u16(&frame[kHeader]);
+        if (!stats.haveCells || base != stats.cellSeq) {
+            if (stats.haveCells)
+                std::printf(" delta   builds on %u which never arrived, waiting for a key frame\n", base);
+            else
+                std::printf(" delta   waiting for a key frame\n");
+            stats.haveCells = false;
+            stats.stale++;
+            return;
+        }
+        // Updates one after another, each against the one before
+        for (size_t pos = kHeader + 2; pos < body; ) {
+            int used = deltaDecode(&frame[pos], static_cast<int>(body - pos), stats.cellRef, kCells);
+            if (used == 0) {
+                std::printf("%s delta   malformed, waiting for a key frame\n", pos == kHeader + 2 ? "" : "                ");
+                stats.haveCells = false;
+                stats.stale++;
+                return;
+            }
+            if (pos != kHeader + 2)
+                std::printf("                ");
+            std::printf(" delta  ");
+            for (int c = 0; c < kCells; c++)
+                std::printf(" %6.4f", stats.cellRef[c] / 10000.0);
+            std::printf("\n");
+            stats.deltaUpdates++;
+            pos += used;
+        }
+        stats.cellSeq = seq;
+        return;
+    }
+    if (channel)
+        printChannel(*channel, frame.data());
+    else
+        printStatus(frame.data());
+}
+
+// Spacing of each frame type, and how far each gap was from the usual one.
+// A gap across a dropped frame of that type lands in the last bin
+void printTiming(Stats &stats)
+{
+    for (auto &entry : stats.gaps) {
+        std::vector<uint32_t> &gaps = entry.second;
+        if (gaps.empty())
+            continue;
+        std::vector<uint32_t> sorted = gaps;
+        std::sort(sorted.begin(), sorted.end());
+        uint32_t usual = sorted[sorted.size() / 2];
+        double mean = 0;
+        size_t bins[kJitterBins] = {};
+        for (uint32_t gap : gaps) {
+            mean += gap;
+            long off = static_cast<long>(gap) - static_cast<long>(usual);
+            off = std::max(-4L, std::min(4L, off));
+            bins[off + 4]++;
+        }
+        mean /= gaps.size();
+        std::fprintf(stderr, "%-8s %zu gaps, median %u mS, mean %.2f, %u-%u mS, from median:",
+                     typeName(entry.first), gaps.size(), usual, mean, sorted.front(), sorted.back());
+        for (int b = 0; b < kJitterBins; b++)
+            std::fprintf(stderr, " %s%d:%zu", b == 0 ? "<=" : b == kJitterBins - 1 ? ">=+" : b > 4 ? "+" : "",
+                         b - 4, bins[b]);
+        std::fprintf(stderr, "\n");
+    }
+    if (stats.loopPasses) {
+        std::fprintf(stderr, "loop     %u passes, mean %.2f mS, %u-%u mS, longest pass per loop frame:",
+                     stats.loopPasses, static_cast<double>(stats.loopWindow) / stats.loopPasses,
+                     stats.loopMin, stats.loopMax);
+        for (auto &worst : stats.loopWorst)
+            std::fprintf(stderr, " %u:%zu", worst.first, worst.second);
+        std::fprintf(stderr, "\n");
+    }
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::ifstream file;
+    if (argc > 1) {
+        file.open(argv[1], std::ios::binary);
+        if (!file) {
+            std::fprintf(stderr, "can't open %s\n", argv[1]);
+            return 1;
+        }
+    }
+    std::istream &in = argc > 1 ? file : std::cin;
+
+    Stats stats;
+    std::vector<uint8_t> raw;
+    bool synced = false; // Bytes before the first 0x00 are a partial frame
+    char c;
+    std::printf("  seq  time (S)  cells (V) x%d   current   temps (C) x%d   soc  ekf  actions sensors faults\n",
+                kCells, kTemps);
+    while (in.get(c)) {
+        uint8_t byte = static_cast<uint8_t>(c);
+        if (byte != 0) {
+            raw.push_back(byte);
+            continue;
+        }
+        if (synced && !raw.empty())
+            handleFrame(raw, stats);
+        synced = true;
+        raw.clear();
+    }
+
+    std::fprintf(stderr, "%zu frames, %zu dropped, %zu bad crc, %zu bad framing, %zu unknown\n",
+                 stats.frames, stats.dropped, stats.badCrc, stats.badCobs, stats.unknown);
+    size_t cellUpdates = stats.keyFrames + stats.deltaUpdates;
+    if (stats.deltaFrames)
+        std::fprintf(stderr, "cells: %zu key %zu delta frames with %zu updates (%zu lost their base), "
+                     "%.1f bytes per update, %.1f for a delta update, %d for key frames only\n",
+                     stats.keyFrames, stats.deltaFrames, stats.deltaUpdates, stats.stale,
+                     static_cast<double>(stats.keyBytes + stats.deltaBytes) / cellUpdates,
+                     stats.deltaUpdates ? static_cast<double>(stats.deltaBytes) / stats.deltaUpdates : 0.0,
+                     kCells * 2 + 9);
+    printTiming(stats);
+    return stats.frames == 0 ? 1 : 0;
+}
@@ -0,0 +1,194 @@
+/*
+ * File:   trace_decode.cpp
+ * Author: trm84
+ *
+ * Created on October 19, 2026, 9:40 PM
+ *
+ * Host decoder for the black box dump (see trace.h). Reads a raw serial
+ * capture, finds every trace frame in it and prints the records oldest
+ * first as a table. Both forms of the dump are found: the raw frame sent
+ * in console mode and the TLM_TRACE telemetry frames sent in binary mode,
+ * which are COBS decoded, CRC checked and put back together.
+ *
+ * Build: g++ -std=c++17 -O2 -o trace_decode trace_decode.cpp
+ * Use:   trace_decode capture.bin      (or pipe the capture into stdin)
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+namespace {
+
+const uint8_t kSync1 = 0xA5;
+const uint8_t kSync2 = 0x5A;
+const uint8_t kVersion = 1;
+const size_t kRecordSize = 8;
+const size_t kMaxRecords = 16;
+const int kCellBase = 28000;    // Codes (100uV)
+const int kCellShift = 6;
+const int kCurrentStep = 128;   // mA
+const uint8_t kTypeTrace = 0x22;    // TLM_TRACE
+const size_t kHeader = 5;           // Telemetry header: type, sequence number, time
+
+void printRecord(size_t index, const uint8_t *r)
+{
+    unsigned time = r[0] | (r[1] << 8);
+    double minCell = (kCellBase + (r[2] << kCellShift)) / 10000.0;
+    double maxCell = (kCellBase + (r[3] << kCellShift)) / 10000.0;
+    double current = static_cast<int8_t>(r[4]) * kCurrentStep / 1000.0;
+    int temp = static_cast<int8_t>(r[5]);
+    unsigned faults = r[6] | ((r[7] & 0x0F) << 8);
+    unsigned late = r[7] >> 4;
+    std::printf("%3zu %6u %7.3f %7.3f %8.3f %5d  0x%03X  0x%X\n",
+                index, time, minCell, maxCell, current, temp, faults, late);
+}
+
+void printTable(size_t count, const uint8_t *records)
+{
+    std::printf("  #  time_ms  min_V   max_V   current_A  temp  faults  late\n");
+    for (size_t i = 0; i < count; i++)
+        printRecord(i, &records[i * kRecordSize]);
+}
+
+// Decodes the frame starting at data[pos] (the first sync byte). Returns the
+// number of bytes used, or 0 if it isn't a valid frame.
+size_t decodeFrame(const std::vector<uint8_t> &data, size_t pos)
+{
+    if (pos + 6 > data.size() || data[pos + 2] != kVersion)
+        return 0;
+    size_t count = data[pos + 3];
+    bool frozen = data[pos + 4] != 0;
+    size_t length = 5 + count * kRecordSize + 1;
+    if (count > kMaxRecords || pos + length > data.size())
+        return 0;
+
+    uint8_t check = 0;
+    for (size_t i = pos + 2; i < pos + length - 1; i++)
+        check ^= data[i];
+    if (check != data[pos + length - 1]) {
+        std::fprintf(stderr, "frame at %zu: bad checksum\n", pos);
+        return 0;
+    }
+
+    std::printf("frame at byte %zu: %zu records%s\n", pos, count,
+                frozen ? ", frozen by a trip" : "");
+    printTable(count, &data[pos + 5]);
+    return length;
+}
+
+uint16_t crc16(const uint8_t *data, size_t length)
+{
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= static_cast<uint16_t>(data[i]) << 8;
+        for (int b = 0; b < 8; b++)
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+bool cobsDecode(const std::vector<uint8_t> &in, std::vector<uint8_t> &out)
+{
+    out.clear();
+    size_t i = 0;
+    while (i < in.size()) {
+        uint8_t code = in[i++];
+        if (code == 0 || i + code - 1 > in.size())
+            return false;
+        for (uint8_t k = 1; k < code; k++)
+            out.push_back(in[i++]);
+        if (code != 0xFF && i < in.size())
+            out.push_back(0);
+    }
+    return true;
+}
+
+// Finds the TLM_TRACE frames of binary mode dumps and prints each dump once
+// all of its records are in. Returns the number of dumps printed
+size_t decodeTelemetry(const std::vector<uint8_t> &data)
+{
+    size_t dumps = 0;
+    std::vector<uint8_t> raw;
+    std::vector<uint8_t> frame;
+    std::vector<uint8_t> records;
+    size_t start = 0;
+    for (size_t pos = 0; pos < data.size(); pos++) {
+        if (data[pos] != 0) {
+            raw.push_back(data[pos]);
+            continue;
+        }
+        bool ok = cobsDecode(raw, frame) && frame.size() >= kHeader + 6 && frame[0] == kTypeTrace;
+        size_t start_of_frame = pos - raw.size();
+        raw.clear();
+        if (!ok)
+            continue;
+        size_t body = frame.size() - 2;
+        if (crc16(frame.data(), body) != (frame[body] | (frame[body + 1] << 8))) {
+            std::fprintf(stderr, "trace frame at %zu: bad CRC\n", start_of_frame);
+            continue;
+        }
+        const uint8_t *p = &frame[kHeader];
+        size_t count = p[1];
+        size_t first = p[3];
+        size_t length = body - kHeader - 4;
+        if (p[0] != kVersion || count > kMaxRecords || length % kRecordSize != 0)
+            continue;
+        if (first == 0) {
+            records.clear();
+            start = start_of_frame;
+        }
+        if (first != records.size() / kRecordSize) {
+            std::fprintf(stderr, "trace frame at %zu: records from %zu, a frame before it was lost\n",
+                         start_of_frame, first);
+            records.clear();
+            continue;
+        }
+        records.insert(records.end(), p + 4, p + 4 + length);
+        if (records.size() / kRecordSize == count) {
+            std::printf("dump at byte %zu: %zu records%s\n", start, count,
+                        p[2] ? ", frozen by a trip" : "");
+            printTable(count, records.data());
+            records.clear();
+            dumps++;
+        }
+    }
+    return dumps;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::vector<uint8_t> data;
+    if (argc > 1) {
+        std::ifstream in(argv[1], std::ios::binary);
+        if (!in) {
+            std::fprintf(stderr, "can't open %s\n", argv[1]);
+            return 1;
+        }
+        data.assign(std::istreambuf_iterator<char>(in), {});
+    } else {
+        data.assign(std::istreambuf_iterator<char>(std::cin), {});
+    }
+
+    size_t frames = 0;
+    for (size_t pos = 0; pos + 1 < data.size(); pos++) {
+        if (data[pos] != kSync1 || data[pos + 1] != kSync2)
+            continue;
+        size_t used = decodeFrame(data, pos);
+        if (used != 0) {
+            frames++;
+            pos += used - 1;
+        }
+    }
+    frames += decodeTelemetry(data);
+    if (frames == 0) {
+        std::fprintf(stderr, "no trace frames found\n");
+        return 1;
+    }
+    return 0;
+}
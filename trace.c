@@ -0,0 +1,127 @@
+/*
+ * File:   trace.c
+ * Author: trm84
+ *
+ * Created on October 19, 2026, 9:00 PM
+ */
+
+#include <xc.h>
+#include "trace.h"
+#include "uart.h"
+#include "telemetry.h"
+
+//Not cleared by the C startup so a trip survives the reset it causes
+__persistent unsigned char traceRing[TRACE_RECORDS][TRACE_RECORD_SIZE];
+__persistent unsigned char traceHead; //Next record to write, also the oldest once full
+__persistent unsigned char traceCount; //Records held
+__persistent unsigned char tracePost; //Records left before freezing, 0 when not tripped
+__persistent char traceStopped; //Ring is frozen
+__persistent unsigned int traceValid; //TRACE_MAGIC when the above can be trusted
+
+//Dumps a frozen ring left over from before the reset, then starts recording again
+void traceInit(){
+    if(traceValid == TRACE_MAGIC && traceStopped){
+        traceDump();
+    }
+    traceHead = 0;
+    traceCount = 0;
+    tracePost = 0;
+    traceStopped = 0;
+    traceValid = TRACE_MAGIC;
+}
+
+//Packs one pass into the ring
+void traceRecord(unsigned long now, unsigned int minCell, unsigned int maxCell, long current, int temp, unsigned int faults, unsigned char late){
+    if(traceStopped){
+        return;
+    }
+    unsigned char *r = traceRing[traceHead];
+    r[0] = (unsigned char)now;
+    r[1] = (unsigned char)(now >> 8);
+    r[2] = minCell > TRACE_CELL_BASE ? (unsigned char)((minCell - TRACE_CELL_BASE) >> 6) : 0;
+    r[3] = maxCell > TRACE_CELL_BASE ? (unsigned char)((maxCell - TRACE_CELL_BASE) >> 6) : 0;
+    current >>= 7;
+    r[4] = current > 127 ? 127 : (current < -127 ? (unsigned char)-127 : (unsigned char)current);
+    r[5] = (unsigned char)temp;
+    r[6] = (unsigned char)faults;
+    r[7] = (unsigned char)(((faults >> 8) & 0x0F) | (late << 4));
+
+    traceHead++;
+    if(traceHead >= TRACE_RECORDS){
+        traceHead = 0;
+    }
+    if(traceCount < TRACE_RECORDS){
+        traceCount++;
+    }
+    if(tracePost != 0 && --tracePost == 0){
+        traceStopped = 1;
+    }
+}
+
+//Called on a trip, the ring stops TRACE_POST records later. Later trips don't move it
+void traceFreeze(){
+    if(tracePost == 0 && !traceStopped){
+        tracePost = TRACE_POST;
+    }
+}
+
+//Returns 1 once the ring has stopped
+char traceFrozen(){
+    return traceStopped;
+}
+
+//Sends the ring from oldest on in frames of up to TLM_TRACE_RECORDS records.
+//An empty ring still sends one frame so the host sees the dump happened
+void traceDumpFrames(unsigned char oldest){
+    unsigned char data[TLM_TRACE_RECORDS*TRACE_RECORD_SIZE];
+    unsigned char index = oldest;
+    unsigned char first = 0;
+    do{
+        unsigned char count = 0;
+        while(count < TLM_TRACE_RECORDS && first + count < traceCount){
+            for(int j = 0; j < TRACE_RECORD_SIZE; j++){
+                data[count*TRACE_RECORD_SIZE + j] = traceRing[index][j];
+            }
+            count++;
+            index++;
+            if(index >= TRACE_RECORDS){
+                index = 0;
+            }
+        }
+        telemetryTrace(TRACE_VERSION, traceCount, traceStopped, first, data, count);
+        first += count;
+    }while(first < traceCount);
+}
+
+//Sends the ring oldest first. Polled, so it works before the UART interrupt
+//is running and 134 bytes won't fit the TX ring. In binary mode it goes out
+//as TLM_TRACE frames so the dump can't break up the COBS stream
+void traceDump(){
+    unsigned char check = 0;
+    unsigned char oldest = traceCount < TRACE_RECORDS ? 0 : traceHead;
+    unsigned char header[3] = {TRACE_VERSION, traceCount, traceStopped};
+
+    if(telemetryMode() == TLM_BINARY){
+        traceDumpFrames(oldest);
+        return;
+    }
+    uartWait(); //Let the ring empty first
+    uartPutc(TRACE_SYNC1);
+    uartPutc(TRACE_SYNC2);
+    for(int i = 0; i < 3; i++){
+        uartPutc(header[i]);
+        check ^= header[i];
+    }
+    unsigned char index = oldest;
+    for(int i = 0; i < traceCount; i++){
+        for(int j = 0; j < TRACE_RECORD_SIZE; j++){
+            uartPutc(traceRing[index][j]);
+            check ^= traceRing[index][j];
+        }
+        index++;
+        if(index >= TRACE_RECORDS){
+            index = 0;
+        }
+    }
+    uartPutc(check);
+}
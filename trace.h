@@ -0,0 +1,65 @@
+/* Microchip Technology Inc. and its subsidiaries.  You may use this software
+ * and any derivatives exclusively with Microchip products.
+ *
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+ * TERMS.
+ */
+
+/*
+ * File: trace
+ * Author: Tyler Matthews
+ * Comments: Black box. A RAM ring of the last TRACE_RECORDS main loop passes,
+ *           packed into 8 bytes each:
+ *             0-1 time (mS, low 16 bits)     4 current (128mA, signed)
+ *             2   lowest cell                5 highest temp (C, signed)
+ *             3   highest cell               6-7 fault bits 0-11, late tasks 12-15
+ *           Cells are (code - TRACE_CELL_BASE) >> 6, so 6.4mV steps from 2.8V.
+ *           Recording is shifts and stores only, no divides.
+ *           A trip freezes the ring TRACE_POST records later so the moments
+ *           after the trip are kept too. The ring is persistent, so it
+ *           survives a WDT or MCLR reset and is dumped on the next boot.
+ *           Dump frame: 0xA5 0x5A, version, records, frozen, the records
+ *           oldest first, then an XOR of everything after the sync bytes.
+ *           That is the console mode dump. In binary mode the records go
+ *           out as TLM_TRACE telemetry frames (telemetry.h) instead, so
+ *           the dump keeps to the COBS framing of the stream.
+ *           tools/trace_decode.cpp turns a capture back into a table.
+ * Revision history:
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+//Defines
+    #define TRACE_RECORDS 16 //8 bytes each
+    #define TRACE_RECORD_SIZE 8
+    #define TRACE_POST 4 //Records kept after the trip
+    #define TRACE_CELL_BASE 28000 //Codes (2.8V)
+    #define TRACE_VERSION 1
+    #define TRACE_SYNC1 0xA5
+    #define TRACE_SYNC2 0x5A
+    #define TRACE_MAGIC 0x7AC3 //Marks the persistent ring as valid after a reset
+
+//Prototypes
+    void traceInit();
+    void traceRecord(unsigned long now, unsigned int minCell, unsigned int maxCell, long current, int temp, unsigned int faults, unsigned char late);
+    void traceFreeze();
+    char traceFrozen();
+    void traceDump();
+    void traceDumpFrames(unsigned char oldest);
+
+#endif
@@ -1,99 +1,110 @@
-/*
- * File:   uart.c
- * Author: trm84
- *
- * Created on February 6, 2019, 9:05 AM
- */
-
-
-#include "uart.h"
-
-void writeValuesToUart(float voltageArr[], int voltageArrLength, float totalVoltage, int balanceEn[], int temperatureArr[], int temperatureArrLength, int temperatureHigh, float current, float soc, int uartLines){
-    int index = 0;
-    
-    while(PIE1bits.TXIE); //can't start until tx buffer is empty
-    clearScreen(uartLines);
-    
-    writeVoltages(voltageArr, voltageArrLength, totalVoltage, balanceEn, &index);
-    writeTemps(temperatureArr, temperatureHigh , temperatureArrLength, &index);
-    writeCurrent(current, &index);
-    writeSOC(soc, &index);
-    
-    while(PIE1bits.TXIE); //can't start until buffer is empty
-    uartEnable();
-}
-
-void writeSOC(float soc, int *index){
-    *index += sprintf(&str[*index], "SOC = %0.4f percent \n\r", (soc*100));
-}
-
-void writeVoltages(float volts[], int length, float totalVoltage, int balanceEn[], int *index){
-    int maxCell = 0;
-    int minCell = 0;
-    
-    for(int k = 0; k < length; k++){        
-        if(volts[k]<volts[minCell]){
-            minCell = k;
-        }else if(volts[k] > volts[maxCell]){
-            maxCell = k;
-        }
-        
-        if(balanceEn[k]){
-            *index += sprintf(&str[*index], "V%i = %0.4fV [X]\n\r", k+1, volts[k]);
-        }else{
-            *index += sprintf(&str[*index], "V%i = %0.4fV\n\r", k+1, volts[k]);
-        }
-    }
-    //writes the pack voltage to the uart buffer
-    *index += sprintf(&str[*index], "Pack Voltage: %0.4fV\n\r", totalVoltage); 
-    
-    *index += sprintf(&str[*index], "Max Difference = V%i & V%i @ %0.4fV\n\r", minCell+1, maxCell+1, (volts[maxCell] - volts[minCell]));     
-    
-}
-
-void writeCurrent(float current, int *index){
-    *index += sprintf(&str[*index], "current = %0.4fA\n\r", current);
-}
-
-void writeTemps(int temps[], int highestTemp, int numTemps, int *index){
-    for(int k = 0; k<numTemps; k++){ //loops through temperature array and writes each temp to uart buffer
-        *index += sprintf(&str[*index], "Temp%i = %iC\n\r", k+1, temps[k]); 
-   }
-
-    //writes the highest temperature to the uart buffer
-    *index += sprintf(&str[*index], "Highest Temp: %iC\n\r", highestTemp); 
-}
-
-void clearScreen(int numLines){
-    int j = 0;
-    
-    for(j = 0; j < numLines-1; j++){
-       sprintf(&str[0], "\33[2K \033[A");
-        uartEnable();
-        while(PIE1bits.TXIE);
-    }
-    //Moves to beginning of the line
-    sprintf(&str[0], "\33[2K \033[A \r");
-    uartEnable();
-    while(PIE1bits.TXIE);
-}
-
-void uartEnable(){
-    PIE1bits.TXIE = 1;
-}
-
-void uartDisable(){
-    PIE1bits.TXIE = 0;   
-}
-
-void uartSetup(){
-    TXSTAbits.TX9 = 0; //8 bit transmission
-    TXSTAbits.TXEN = 1; //TX Enable
-    TXSTAbits.SYNC = 0; //Asynch
-    TXSTAbits.BRGH = 0; //Low Baud
-    RCSTAbits.RX9 = 0; //8 BIT DATA TRANSFER
-    RCSTAbits.SPEN = 1; //SERIAL PORT EN
-    SPBRGH = 0; //VAUD RATE
-    SPBRGL = 2; //BAUD RATE: 207 = 2400, 51 = 9600, 47 = 10417, 25 = 19200, 3 = 125000
-    PIR1bits.TXIF = 0; //Interrupt Flag
-}
+/*
+ * File:   uart.c
+ * Author: trm84
+ *
+ * Created on February 6, 2019, 9:05 AM
+ */
+
+
+#include "uart.h"
+
+unsigned char txRing[UART_RING_SIZE]; //Bytes waiting for the TX ISR
+volatile unsigned char txHead = 0; //Next free slot
+volatile unsigned char txTail = 0; //Next byte to send
+unsigned int uartTimeouts = 0; //Ring drains and polled bytes that never finished
+unsigned int uartOverflows = 0; //Records dropped because the ring was full
+unsigned char rxRing[UART_RX_SIZE]; //Bytes waiting for commandService()
+volatile unsigned char rxHead = 0; //Next free slot
+volatile unsigned char rxTail = 0; //Next byte to read
+unsigned char rxByte; //ISR scratch
+unsigned int uartRxDropped = 0; //Received bytes lost to a full ring or FIFO overrun
+
+//Free bytes in the ring. One slot is always left empty so full and empty differ
+unsigned char uartRoom(){
+    return (unsigned char)((txTail - txHead - 1) & UART_RING_MASK);
+}
+
+//Copies as much of data as fits into the ring and returns how much that was.
+//Never waits, the TX ISR drains the ring in the background
+int uartQueue(const unsigned char data[], int length){
+    unsigned char head = txHead;
+    int room = uartRoom();
+    if(length > room){
+        length = room;
+    }
+    for(int i = 0; i < length; i++){
+        txRing[head] = data[i];
+        head = (head + 1) & UART_RING_MASK;
+    }
+    txHead = head; //One byte, so the ISR sees all of the new data or none of it
+    if(length > 0){
+        PIE1bits.TXIE = 1;
+    }
+    return length;
+}
+
+//Queues a whole record or none of it, so a full ring never tears a frame.
+//Returns 0 and counts an overflow if it didn't fit
+char uartWrite(const unsigned char data[], int length){
+    if(length > uartRoom()){
+        uartOverflows++;
+        return 0;
+    }
+    uartQueue(data, length);
+    return 1;
+}
+
+//Returns the next received byte, or -1 if nothing has arrived
+int uartRead(){
+    if(rxTail == rxHead){
+        return -1;
+    }
+    unsigned char c = rxRing[rxTail];
+    rxTail = (rxTail + 1) & UART_RX_MASK;
+    return c;
+}
+
+//Waits for the ring to empty, only for one off dumps that poll the port.
+//Gives up after UART_TIMEOUT and drops the rest so a stuck port can't hang the caller
+void uartWait(){
+    unsigned long start = getMillis();
+    while(PIE1bits.TXIE){
+        if(getMillis() - start > UART_TIMEOUT){
+            uartDisable();
+            txTail = txHead;
+            uartTimeouts++;
+            return;
+        }
+    }
+}
+
+//Sends one byte by polling TXIF, for dumps too big for the ring.
+//Only use once uartWait() has emptied it
+void uartPutc(unsigned char c){
+    unsigned int timeout = UART_PUTC_TIMEOUT;
+    while(PIR1bits.TXIF == 0 && --timeout);
+    if(timeout == 0){
+        uartTimeouts++;
+        return;
+    }
+    TXREG = c;
+}
+
+void uartDisable(){
+    PIE1bits.TXIE = 0;   
+}
+
+void uartSetup(){
+    TXSTAbits.TX9 = 0; //8 bit transmission
+    TXSTAbits.TXEN = 1; //TX Enable
+    TXSTAbits.SYNC = 0; //Asynch
+    TXSTAbits.BRGH = 0; //Low Baud
+    RCSTAbits.RX9 = 0; //8 BIT DATA TRANSFER
+    RCSTAbits.SPEN = 1; //SERIAL PORT EN
+    RCSTAbits.CREN = 1; //RX Enable
+    TRISCbits.TRISC7 = 1; //RX pin is an input
+    SPBRGH = 0; //VAUD RATE
+    SPBRGL = 2; //BAUD RATE: 207 = 2400, 51 = 9600, 47 = 10417, 25 = 19200, 3 = 125000
+    PIR1bits.TXIF = 0; //Interrupt Flag
+    PIE1bits.RCIE = 1; //RX Interrupt, commands come in one byte at a time
+}
@@ -1,49 +1,97 @@
-/* Microchip Technology Inc. and its subsidiaries.  You may use this software 
- * and any derivatives exclusively with Microchip products. 
- * 
- * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
- * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
- * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
- * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
- * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
- *
- * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
- * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
- * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
- * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
- * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
- * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
- * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
- *
- * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
- * TERMS. 
- */
-
-/* 
- * File: uart
- * Author: Tyler Matthews
- * Comments: UART is used to communicate to a console via the FTDI chip
- * Revision history: 
- */
-
-//Includes
-    #include <xc.h> // include processor files - each processor file is guarded.  
-    #include "timer.h"
-    #include <stdio.h>
-
-//Defines
-
-//Variables
-    char str[500]; //Character Buffer
-    int n; //Array Location
-    
-//Prototypes
-    void writeValuesToUart(float voltageArr[], int voltageArrLength, float totalVoltage, int balanceEn[], int temperatureArr[], int temperatureArrLength, int temperatureHigh, float current, float soc, int uartLines);
-    void uartSetup();
-    void writeVoltages(float volts[], int length, float totalVoltage, int balanceEn[], int *index);
-    void writeTemps(int temps[], int highestTemp, int numTemps, int *index);
-    void clearScreen(int numLines);
-    void uartEnable();
-    void uartDisable();
-    void writeCurrent(float current, int *index);
-    void writeSOC(float soc, int *index);
\ No newline at end of file
+/* Microchip Technology Inc. and its subsidiaries.  You may use this software 
+ * and any derivatives exclusively with Microchip products. 
+ * 
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER 
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED 
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A 
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION 
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION. 
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND 
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS 
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE 
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS 
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF 
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE 
+ * TERMS. 
+ */
+
+/* 
+ * File: uart
+ * Author: Tyler Matthews
+ * Comments: UART is used to communicate to a console via the FTDI chip
+ * Revision history: 
+ */
+
+#ifndef UART_H
+#define UART_H
+
+//Includes
+    #include <xc.h> // include processor files - each processor file is guarded.  
+    #include "timer.h"
+
+//Defines
+    #define UART_RING_SIZE 128 //TX ring, a power of two so the indices wrap with a mask
+    #define UART_RING_MASK (UART_RING_SIZE - 1)
+    #define UART_STR_SIZE 72 //An encoded telemetry frame (TLM_MAX_FRAME + 2) or a console row
+    #define UART_RX_SIZE 256 //RX ring, a power of two. Holds what arrives in the slowest pass (~15mS at 16667 bytes/S)
+    #define UART_RX_MASK (UART_RX_SIZE - 1)
+    #define UART_TIMEOUT 50 //mS to drain the ring (128 bytes at ~60uS each is ~8mS)
+    #define UART_PUTC_TIMEOUT 1000 //Polls of TXIF, a byte takes ~50
+
+    //Sends the next queued byte, called from the ISR on TXIF. Turns the
+    //interrupt off once the ring is empty, uartQueue() turns it back on
+    #define UART_TX_TICK() do{ \
+        if(txTail != txHead){ \
+            TXREG = txRing[txTail]; \
+            txTail = (txTail + 1) & UART_RING_MASK; \
+        }else{ \
+            PIE1bits.TXIE = 0; \
+        } \
+    }while(0)
+
+    //Moves a received byte into the RX ring, called from the ISR on RCIF.
+    //Bytes that arrive with the ring full are dropped and counted
+    #define UART_RX_TICK() do{ \
+        if(RCSTAbits.OERR){ /*Hardware FIFO overran, only a CREN toggle clears it*/ \
+            RCSTAbits.CREN = 0; \
+            RCSTAbits.CREN = 1; \
+            uartRxDropped++; \
+        } \
+        rxByte = RCREG; \
+        if(((rxHead + 1) & UART_RX_MASK) != rxTail){ \
+            rxRing[rxHead] = rxByte; \
+            rxHead = (rxHead + 1) & UART_RX_MASK; \
+        }else{ \
+            uartRxDropped++; \
+        } \
+    }while(0)
+
+//Variables
+    char str[UART_STR_SIZE]; //Formatting buffer, producers queue it into the ring
+    int n; //Array Location
+    extern unsigned char txRing[UART_RING_SIZE]; //Bytes waiting for the TX ISR
+    extern volatile unsigned char txHead; //Next free slot, only producers move it
+    extern volatile unsigned char txTail; //Next byte to send, only the ISR moves it
+    extern unsigned int uartTimeouts; //Ring drains and polled bytes that never finished
+    extern unsigned int uartOverflows; //Records dropped because the ring was full
+    extern unsigned char rxRing[UART_RX_SIZE]; //Bytes waiting for commandService()
+    extern volatile unsigned char rxHead; //Next free slot, only the ISR moves it
+    extern volatile unsigned char rxTail; //Next byte to read, only uartRead() moves it
+    extern unsigned char rxByte; //ISR scratch
+    extern unsigned int uartRxDropped; //Received bytes lost to a full ring or FIFO overrun
+    
+//Prototypes
+    void uartSetup();
+    void uartDisable();
+    unsigned char uartRoom();
+    int uartQueue(const unsigned char data[], int length);
+    char uartWrite(const unsigned char data[], int length);
+    void uartWait();
+    void uartPutc(unsigned char c);
+    int uartRead();
+
+#endif
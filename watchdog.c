@@ -0,0 +1,96 @@
+/*
+ * File:   watchdog.c
+ * Author: trm84
+ *
+ * Created on October 19, 2026, 8:15 PM
+ */
+
+#include "watchdog.h"
+#include "eeprom.h"
+
+//mS each task may go without checking in, all well inside the 2S WDT
+const unsigned int taskDeadline[TASKS] = {
+    500, //TASK_MEASURE
+    500, //TASK_CURRENT
+    500, //TASK_FAULT
+    1500, //TASK_UART, UART_PERIOD plus the write and any EEPROM saves
+};
+
+unsigned long taskLast[TASKS]; //Last check in (mS)
+unsigned char taskLate = 0; //Tasks past their deadline at the last service, one bit each
+char lastReset = RESET_POR;
+
+//Works out why the part reset, counts it in EEPROM and re-arms the flags.
+//Must run first thing in main, before anything can clear the WDT
+void resetRecord(){
+    if(PCONbits.nPOR == 0){
+        lastReset = RESET_POR;
+    }else if(PCONbits.nBOR == 0){
+        lastReset = RESET_BOR;
+    }else if(PCONbits.nRWDT == 0 || STATUSbits.nTO == 0){
+        lastReset = RESET_WDT;
+    }else if(PCONbits.STKOVF || PCONbits.STKUNF){
+        lastReset = RESET_STACK;
+    }else if(PCONbits.nRI == 0){
+        lastReset = RESET_SOFTWARE;
+    }else{
+        lastReset = RESET_MCLR;
+    }
+    PCON = 0b00011111; //Set the active low flags, clear the stack flags
+
+    unsigned char count = eepromRead(EE_RESET_COUNTS + lastReset);
+    if(count == 0xFF){ //Erased EEPROM, start the counts over
+        for(int i = 0; i < RESET_REASONS; i++){
+            eepromWrite(EE_RESET_COUNTS + i, 0);
+        }
+        count = 0;
+    }
+    if(count < 0xFE){ //Saturate below the erased value
+        eepromWrite(EE_RESET_COUNTS + lastReset, count + 1);
+    }
+    eepromWrite(EE_RESET_REASON, lastReset);
+}
+
+//Starts the WDT with every task checked in
+void watchdogStart(unsigned long now){
+    for(int i = 0; i < TASKS; i++){
+        taskLast[i] = now;
+    }
+    WDTCONbits.WDTPS = WDT_PRESCALE;
+    CLRWDT();
+    WDTCONbits.SWDTEN = 1;
+}
+
+//Called by each task every time it runs
+void taskCheckIn(char task, unsigned long now){
+    taskLast[task] = now;
+}
+
+//Clears the WDT only if every task is inside its deadline
+void watchdogService(unsigned long now){
+    unsigned char late = 0;
+    for(int i = 0; i < TASKS; i++){
+        if(now - taskLast[i] > taskDeadline[i]){
+            late |= 1 << i;
+        }
+    }
+    taskLate = late;
+    if(late == 0){
+        CLRWDT();
+    }
+}
+
+//Returns the tasks that were late at the last service, one bit each
+unsigned char watchdogLate(){
+    return taskLate;
+}
+
+//Returns why the part last reset (RESET_x)
+char resetReason(){
+    return lastReset;
+}
+
+//Returns how many times the part has reset for a reason
+unsigned char resetCount(char reason){
+    return eepromRead(EE_RESET_COUNTS + reason);
+}
@@ -0,0 +1,69 @@
+/* Microchip Technology Inc. and its subsidiaries.  You may use this software
+ * and any derivatives exclusively with Microchip products.
+ *
+ * THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS".  NO WARRANTIES, WHETHER
+ * EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+ * WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+ * PARTICULAR PURPOSE, OR ITS INTERACTION WITH MICROCHIP PRODUCTS, COMBINATION
+ * WITH ANY OTHER PRODUCTS, OR USE IN ANY APPLICATION.
+ *
+ * IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+ * INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+ * WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+ * BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.  TO THE
+ * FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS
+ * IN ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF
+ * ANY, THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+ *
+ * MICROCHIP PROVIDES THIS SOFTWARE CONDITIONALLY UPON YOUR ACCEPTANCE OF THESE
+ * TERMS.
+ */
+
+/*
+ * File: watchdog
+ * Author: Tyler Matthews
+ * Comments: Task monitor in front of the hardware watchdog. Each task checks
+ *           in when it runs and the WDT is only cleared while every task is
+ *           inside its deadline, so one hung task resets the part even if
+ *           the main loop is still spinning. The WDT is started in software
+ *           (WDTE = SWDTEN) after startup, which calibrates and waits far
+ *           longer than the WDT period.
+ *           The reset reason is read from PCON/STATUS on boot and kept in
+ *           EEPROM with a count per reason.
+ * Revision history:
+ */
+
+#ifndef WATCHDOG_H
+#define WATCHDOG_H
+
+//Includes
+    #include <xc.h> // include processor files - each processor file is guarded.
+
+//Defines -- Tasks
+    #define TASK_MEASURE 0 //Cell sweep and temperatures, every main loop pass
+    #define TASK_CURRENT 1 //Current samples
+    #define TASK_FAULT 2 //Fault table
+    #define TASK_UART 3 //Dashboard, balancing and the slow estimators
+    #define TASKS 4
+
+    #define WDT_PRESCALE 0b01011 //1:65536 of the 31kHz LFINTOSC -> 2S
+    
+//Defines -- Reset reasons
+    #define RESET_POR 0 //Power on
+    #define RESET_BOR 1 //Brown out
+    #define RESET_WDT 2 //Watchdog
+    #define RESET_MCLR 3 //Reset pin
+    #define RESET_STACK 4 //Stack overflow or underflow
+    #define RESET_SOFTWARE 5 //RESET instruction
+    #define RESET_REASONS 6
+
+//Prototypes
+    void resetRecord();
+    void watchdogStart(unsigned long now);
+    void taskCheckIn(char task, unsigned long now);
+    void watchdogService(unsigned long now);
+    unsigned char watchdogLate();
+    char resetReason();
+    unsigned char resetCount(char reason);
+
+#endif